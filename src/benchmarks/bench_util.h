@@ -0,0 +1,38 @@
+#ifndef S21_BENCH_UTIL_H
+#define S21_BENCH_UTIL_H
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace s21_bench {
+
+// wall-clock stopwatch started on construction
+class Timer {
+ public:
+  Timer() : start_(std::chrono::steady_clock::now()) {}
+  double ms() const {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - start_)
+        .count();
+  }
+
+ private:
+  std::chrono::steady_clock::time_point start_;
+};
+
+// problem size from the first command line argument, fallback otherwise
+inline size_t arg_size(int argc, char** argv, size_t fallback) {
+  return argc > 1 ? std::strtoull(argv[1], nullptr, 10) : fallback;
+}
+
+inline void report(const std::string& name, size_t n, double ms) {
+  std::cout << name << " n=" << n << ": " << ms << " ms";
+  if (n) std::cout << " (" << ms * 1e6 / n << " ns/op)";
+  std::cout << std::endl;
+}
+
+}  // namespace s21_bench
+
+#endif  // S21_BENCH_UTIL_H
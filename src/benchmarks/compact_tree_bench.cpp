@@ -0,0 +1,93 @@
+// Bytes per element and lookup time of the pointer-linked Tree containers
+// against the CompactTree arena (32-bit links). "heap" counts what malloc
+// really holds: the usable size of every block plus its 8-byte header.
+#include <malloc.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../lib/s21_compact_map.h"
+#include "../lib/s21_compact_set.h"
+#include "../lib/s21_map.h"
+#include "../lib/s21_set.h"
+#include "bench_util.h"
+
+static size_t g_requested = 0;
+static size_t g_heap = 0;
+
+void* operator new(size_t size) {
+  void* p = std::malloc(size);
+  if (p == nullptr) throw std::bad_alloc();
+  g_requested += size;
+  g_heap += malloc_usable_size(p) + 8;
+  return p;
+}
+
+void operator delete(void* ptr, size_t size) noexcept {
+  if (ptr == nullptr) return;
+  g_requested -= size;
+  g_heap -= malloc_usable_size(ptr) + 8;
+  std::free(ptr);
+}
+
+void operator delete(void* ptr) noexcept {
+  // blocks freed without a size are not in the "requested" figure
+  if (ptr == nullptr) return;
+  g_heap -= malloc_usable_size(ptr) + 8;
+  std::free(ptr);
+}
+
+template <typename Container, typename Insert, typename Find>
+static void run(const std::string& name, size_t n, Insert insert, Find find) {
+  std::mt19937_64 rng(1);
+  std::vector<uint64_t> keys(n);
+  for (auto& key : keys) key = rng() % (n * 4);
+  Container container;
+  size_t own_requested = g_requested, own_heap = g_heap;
+  for (uint64_t key : keys) insert(container, key);
+  size_t count = container.size();
+  std::cout << name << ": " << count << " elements, "
+            << static_cast<double>(g_requested - own_requested) / count
+            << " bytes/element requested, "
+            << static_cast<double>(g_heap - own_heap) / count
+            << " bytes/element heap" << std::endl;
+  size_t hits = 0;
+  s21_bench::Timer timer;
+  for (uint64_t key : keys) hits += find(container, key + 1);
+  s21_bench::report("  find", n, timer.ms());
+  std::cout << "  hits: " << hits << std::endl;
+}
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 1000000);
+  run<s21::set<int>>(
+      "set<int>", n, [](s21::set<int>& c, uint64_t k) { c.insert(k); },
+      [](s21::set<int>& c, uint64_t k) { return c.contains(k); });
+  run<s21::compact_set<int>>(
+      "compact_set<int>", n,
+      [](s21::compact_set<int>& c, uint64_t k) { c.insert(k); },
+      [](s21::compact_set<int>& c, uint64_t k) { return c.contains(k); });
+  run<s21::map<int, int>>(
+      "map<int, int>", n,
+      [](s21::map<int, int>& c, uint64_t k) { c.insert(k, k); },
+      [](s21::map<int, int>& c, uint64_t k) { return c.contains(k); });
+  run<s21::compact_map<int, int>>(
+      "compact_map<int, int>", n,
+      [](s21::compact_map<int, int>& c, uint64_t k) { c.insert(k, k); },
+      [](s21::compact_map<int, int>& c, uint64_t k) { return c.contains(k); });
+  run<s21::map<uint64_t, double>>(
+      "map<uint64_t, double>", n,
+      [](s21::map<uint64_t, double>& c, uint64_t k) { c.insert(k, k); },
+      [](s21::map<uint64_t, double>& c, uint64_t k) { return c.contains(k); });
+  run<s21::compact_map<uint64_t, double>>(
+      "compact_map<uint64_t, double>", n,
+      [](s21::compact_map<uint64_t, double>& c, uint64_t k) { c.insert(k, k); },
+      [](s21::compact_map<uint64_t, double>& c, uint64_t k) {
+        return c.contains(k);
+      });
+  return 0;
+}
@@ -0,0 +1,108 @@
+// Throughput scaling of concurrent_unordered_map against one mutex around an
+// s21::unordered_map. Keys follow a Zipf(0.99) distribution over 10^6 keys,
+// 90% of the operations are lookups and 10% insert_or_assign. The thread
+// count doubles up to the command line argument (default: hardware threads).
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../lib/s21_concurrent_unordered_map.h"
+#include "../lib/s21_unordered_map.h"
+#include "bench_util.h"
+
+static const size_t kKeys = 1000000;
+static const size_t kOpsPerThread = 1000000;
+
+// samples ranks 0..n-1 with probability proportional to 1 / (rank + 1)^s
+static std::vector<uint64_t> zipf_trace(size_t count, uint64_t seed) {
+  static std::vector<double> cdf;
+  if (cdf.empty()) {
+    cdf.resize(kKeys);
+    double sum = 0;
+    for (size_t i = 0; i < kKeys; ++i) {
+      sum += 1.0 / std::pow(static_cast<double>(i + 1), 0.99);
+      cdf[i] = sum;
+    }
+    for (double& value : cdf) value /= sum;
+  }
+  std::mt19937_64 rng(seed);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  std::vector<uint64_t> trace(count);
+  for (auto& key : trace) {
+    size_t rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) -
+                  cdf.begin();
+    // scatter the hot keys over the key space
+    key = (std::min(rank, kKeys - 1) * 0x9E3779B97F4A7C15ull) >> 20;
+  }
+  return trace;
+}
+
+template <typename Op>
+static double run_threads(size_t threads,
+                          const std::vector<std::vector<uint64_t>>& traces,
+                          Op op) {
+  std::vector<std::thread> workers;
+  std::atomic<bool> go{false};
+  for (size_t t = 0; t < threads; ++t) {
+    workers.emplace_back([&, t] {
+      while (!go.load()) std::this_thread::yield();
+      const auto& trace = traces[t];
+      for (size_t i = 0; i < trace.size(); ++i) op(trace[i], i % 10 == 0);
+    });
+  }
+  s21_bench::Timer timer;
+  go.store(true);
+  for (auto& worker : workers) worker.join();
+  return timer.ms();
+}
+
+int main(int argc, char** argv) {
+  size_t max_threads = s21_bench::arg_size(
+      argc, argv, std::max(1u, std::thread::hardware_concurrency()));
+  std::vector<std::vector<uint64_t>> traces;
+  for (size_t t = 0; t < max_threads; ++t) {
+    traces.push_back(zipf_trace(kOpsPerThread, t + 1));
+  }
+
+  for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+    size_t ops = threads * kOpsPerThread;
+    {
+      s21::concurrent_unordered_map<uint64_t, uint64_t> map;
+      std::atomic<uint64_t> hits{0};
+      double ms = run_threads(threads, traces, [&](uint64_t key, bool write) {
+        uint64_t value = 0;
+        if (write) {
+          map.insert_or_assign(key, key);
+        } else if (map.find(key, value)) {
+          hits.fetch_add(1, std::memory_order_relaxed);
+        }
+      });
+      s21_bench::report(
+          "concurrent_unordered_map threads=" + std::to_string(threads), ops,
+          ms);
+    }
+    {
+      s21::unordered_map<uint64_t, uint64_t> map;
+      std::mutex lock;
+      std::atomic<uint64_t> hits{0};
+      double ms = run_threads(threads, traces, [&](uint64_t key, bool write) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (write) {
+          map.insert_or_assign(key, key);
+        } else if (map.contains(key)) {
+          hits.fetch_add(1, std::memory_order_relaxed);
+        }
+      });
+      s21_bench::report("mutex + unordered_map threads=" +
+                            std::to_string(threads),
+                        ops, ms);
+    }
+  }
+  return 0;
+}
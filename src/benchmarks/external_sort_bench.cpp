@@ -0,0 +1,59 @@
+// External bulk loading: the input is 10x the memory budget. Pass the number
+// of keys and the budget in bytes to reproduce a 10x-RAM run on local disk:
+//   ./bench_run <keys> <budget> [temp_dir]
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#include "../lib/s21_external_sort.h"
+#include "bench_util.h"
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 2000000);
+  size_t budget = argc > 2 ? std::strtoull(argv[2], nullptr, 10)
+                           : n * sizeof(uint64_t) / 10;
+  std::string temp_dir = argc > 3 ? argv[3] : "/tmp";
+  std::string input = temp_dir + "/s21_bench_unsorted.bin";
+  std::string image = temp_dir + "/s21_bench_sorted.img";
+
+  {
+    std::ofstream out(input, std::ios::binary | std::ios::trunc);
+    std::mt19937_64 rng(1);
+    std::vector<uint64_t> block(1 << 16);
+    for (size_t written = 0; written < n; written += block.size()) {
+      size_t len = std::min(block.size(), n - written);
+      for (size_t i = 0; i < len; ++i) block[i] = rng();
+      out.write(reinterpret_cast<const char*>(block.data()),
+                len * sizeof(uint64_t));
+    }
+  }
+  std::cout << "input " << n * sizeof(uint64_t) / (1 << 20)
+            << " MiB, budget " << budget / (1 << 20) << " MiB" << std::endl;
+
+  {
+    s21_bench::Timer timer;
+    size_t count = s21::external_write_image<uint64_t>(input, image, budget,
+                                                       temp_dir);
+    s21_bench::report("external sort -> mapped_set image", count, timer.ms());
+  }
+  {
+    s21_bench::Timer timer;
+    s21::set<uint64_t> set;
+    size_t count = s21::external_load(input, set, budget, temp_dir);
+    s21_bench::report("external sort -> set::build_sorted", count, timer.ms());
+  }
+  {
+    // baseline: node by node inserts of the unsorted stream
+    s21_bench::Timer timer;
+    s21::set<uint64_t> set;
+    s21::RunReader<uint64_t> reader(input, 1 << 16);
+    uint64_t key;
+    while (reader.next(key)) set.insert(key);
+    s21_bench::report("set::insert of unsorted stream", n, timer.ms());
+  }
+  std::remove(input.c_str());
+  std::remove(image.c_str());
+  return 0;
+}
@@ -0,0 +1,49 @@
+// Batched lookups on a map larger than the last level cache: one find per
+// key against find_many / contains_many on batches of 1024 keys.
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../lib/s21_map.h"
+#include "bench_util.h"
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 4000000);
+  const size_t batch = 1024;
+  const size_t batches = 1000;
+  std::mt19937_64 rng(5);
+
+  std::vector<std::pair<uint64_t, uint64_t>> items(n);
+  for (size_t i = 0; i < n; ++i) items[i] = {i * 2, i};
+  s21::map<uint64_t, uint64_t> map;
+  map.build_sorted(items.begin(), n);
+  std::vector<uint64_t> keys(batch * batches);
+  for (auto& key : keys) key = rng() % (2 * n);
+
+  size_t hits = 0;
+  {
+    s21_bench::Timer timer;
+    for (uint64_t key : keys) hits += map.find(key) != map.end();
+    s21_bench::report("find one by one", keys.size(), timer.ms());
+  }
+  {
+    std::vector<s21::map<uint64_t, uint64_t>::iterator> out(batch, map.end());
+    s21_bench::Timer timer;
+    for (size_t b = 0; b < batches; ++b) {
+      map.find_many(keys.data() + b * batch, batch, out.data());
+      for (auto& it : out) hits += it != map.end();
+    }
+    s21_bench::report("find_many", keys.size(), timer.ms());
+  }
+  {
+    std::vector<uint64_t> bitmap(batch / 64);
+    s21_bench::Timer timer;
+    for (size_t b = 0; b < batches; ++b) {
+      map.contains_many(keys.data() + b * batch, batch, bitmap.data());
+      for (uint64_t word : bitmap) hits += __builtin_popcountll(word);
+    }
+    s21_bench::report("contains_many", keys.size(), timer.ms());
+  }
+  std::cout << "  hits: " << hits << std::endl;
+  return 0;
+}
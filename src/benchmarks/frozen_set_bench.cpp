@@ -0,0 +1,55 @@
+// Lookup throughput of frozen_set (Eytzinger layout) against set::contains
+// and binary search over a sorted s21::vector. The largest size is taken
+// from the command line, sizes grow by 10x starting at 10^4.
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../lib/s21_frozen_set.h"
+#include "../lib/s21_set.h"
+#include "../lib/s21_vector.h"
+#include "bench_util.h"
+
+int main(int argc, char** argv) {
+  size_t max_n = s21_bench::arg_size(argc, argv, 1000000);
+  const size_t queries = 1000000;
+  std::mt19937_64 rng(3);
+
+  for (size_t n = 10000; n <= max_n; n *= 10) {
+    std::vector<uint64_t> keys(n);
+    for (size_t i = 0; i < n; ++i) keys[i] = i * 2;
+    std::vector<uint64_t> probes(queries);
+    for (auto& probe : probes) probe = rng() % (2 * n);
+
+    size_t hits = 0;
+    {
+      s21::frozen_set<uint64_t> set(keys.begin(), keys.end());
+      s21_bench::Timer timer;
+      for (uint64_t probe : probes) hits += set.contains(probe);
+      s21_bench::report("frozen_set::contains keys=" + std::to_string(n),
+                        queries, timer.ms());
+    }
+    {
+      s21::set<uint64_t> set;
+      set.build_sorted(keys.begin(), n);
+      s21_bench::Timer timer;
+      for (uint64_t probe : probes) hits += set.contains(probe);
+      s21_bench::report("set::contains keys=" + std::to_string(n),
+                        queries, timer.ms());
+    }
+    {
+      s21::vector<uint64_t> sorted;
+      sorted.reserve(n);
+      for (uint64_t key : keys) sorted.push_back(key);
+      s21_bench::Timer timer;
+      for (uint64_t probe : probes) {
+        hits += std::binary_search(sorted.begin(), sorted.end(), probe);
+      }
+      s21_bench::report("vector binary_search keys=" + std::to_string(n),
+                        queries, timer.ms());
+    }
+    std::cout << "  hits: " << hits << std::endl;
+  }
+  return 0;
+}
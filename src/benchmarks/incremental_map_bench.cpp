@@ -0,0 +1,57 @@
+// Per-insert latency while a table grows from empty to n elements:
+// unordered_map rehashes everything at once, incremental_unordered_map
+// spreads the work. Prints a histogram with power of two buckets, the
+// 99.9th percentile and the worst insert.
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../lib/s21_incremental_unordered_map.h"
+#include "../lib/s21_unordered_map.h"
+#include "bench_util.h"
+
+template <typename Map>
+static void run(const std::string& name, const std::vector<uint64_t>& keys) {
+  using Clock = std::chrono::steady_clock;
+  std::vector<uint64_t> latencies(keys.size());
+  Map map;
+  s21_bench::Timer timer;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    Clock::time_point start = Clock::now();
+    map.insert(keys[i], i);
+    latencies[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       Clock::now() - start)
+                       .count();
+  }
+  s21_bench::report(name + " insert", keys.size(), timer.ms());
+
+  std::vector<size_t> histogram(64);
+  uint64_t worst = 0;
+  for (uint64_t ns : latencies) {
+    ++histogram[ns ? 64 - __builtin_clzll(ns) : 0];
+    worst = std::max(worst, ns);
+  }
+  std::sort(latencies.begin(), latencies.end());
+  for (size_t bucket = 0; bucket < histogram.size(); ++bucket) {
+    if (histogram[bucket] == 0) continue;
+    std::cout << "  < " << (uint64_t{1} << bucket)
+              << " ns: " << histogram[bucket] << std::endl;
+  }
+  std::cout << "  p99.9: " << latencies[latencies.size() * 999 / 1000]
+            << " ns, max: " << worst / 1000 << " us" << std::endl;
+}
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 4000000);
+  std::mt19937_64 rng(9);
+  std::vector<uint64_t> keys(n);
+  for (auto& key : keys) key = rng();
+
+  run<s21::unordered_map<uint64_t, uint64_t>>("unordered_map", keys);
+  run<s21::incremental_unordered_map<uint64_t, uint64_t>>(
+      "incremental_unordered_map", keys);
+  return 0;
+}
@@ -0,0 +1,78 @@
+// n session intervals, logged roughly in order of their start, each
+// overlapping about 200 others. Stabbing and overlap queries on
+// s21::interval_map against a full scan of an s21::multiset of the same
+// intervals; also times the insertions and erasing a tenth of them.
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../lib/s21_interval_map.h"
+#include "../lib/s21_multiset.h"
+#include "bench_util.h"
+
+using Interval = std::pair<std::pair<uint64_t, uint64_t>, uint64_t>;
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 10000000);
+  std::mt19937_64 rng(21);
+  std::vector<Interval> intervals(n);
+  for (size_t i = 0; i < n; ++i) {
+    uint64_t lo = i * 10 + rng() % 1000;
+    intervals[i] = {{lo, lo + rng() % 4000}, i};
+  }
+  std::vector<uint64_t> points(1000);
+  for (auto& point : points) point = rng() % (n * 10);
+
+  s21::interval_map<uint64_t, uint64_t> map;
+  {
+    s21_bench::Timer timer;
+    for (const auto& item : intervals) map.insert(item);
+    s21_bench::report("interval_map insert", n, timer.ms());
+  }
+
+  uint64_t found = 0;
+  {
+    s21_bench::Timer timer;
+    for (uint64_t point : points) {
+      map.for_each_overlapping(point, point,
+                               [&found](const Interval&) { ++found; });
+    }
+    s21_bench::report("interval_map stabbing", points.size(), timer.ms());
+  }
+  {
+    s21_bench::Timer timer;
+    for (uint64_t point : points) {
+      map.for_each_overlapping(point, point + 10000,
+                               [&found](const Interval&) { ++found; });
+    }
+    s21_bench::report("interval_map overlap width 10^4", points.size(),
+                      timer.ms());
+  }
+  std::cout << "  results: " << found << std::endl;
+
+  {
+    s21::multiset<Interval> multiset(s21::multiset<Interval>::SCAPEGOAT);
+    for (const auto& item : intervals) multiset.insert(item);
+    uint64_t scanned = 0;
+    size_t scans = 5;
+    s21_bench::Timer timer;
+    for (size_t i = 0; i < scans; ++i) {
+      uint64_t point = points[i];
+      for (auto it = multiset.begin(); it != multiset.end(); ++it) {
+        scanned += (*it).first.first <= point && (*it).first.second >= point;
+      }
+    }
+    s21_bench::report("multiset scan stabbing", scans, timer.ms());
+    std::cout << "  results: " << scanned << std::endl;
+  }
+
+  {
+    s21_bench::Timer timer;
+    for (size_t i = 0; i < n; i += 10) {
+      map.erase(map.find(intervals[i].first.first, intervals[i].first.second));
+    }
+    s21_bench::report("interval_map find + erase", n / 10, timer.ms());
+  }
+  return 0;
+}
@@ -0,0 +1,92 @@
+// s21::intrusive_list against s21::list<T*> over the same pool of n
+// connections: linking all of them, a traversal reading a field, moving
+// every connection to a second list and back one at a time by splice,
+// moving them by pop_front + push_back, and unlinking them all. Once with
+// the connections linked in pool order and once in a random order.
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../lib/s21_intrusive_list.h"
+#include "../lib/s21_list.h"
+#include "bench_util.h"
+
+struct Connection {
+  uint64_t id;
+  uint64_t bytes[5];
+  s21::intrusive_list_hook<Connection> hook;
+};
+
+using Intrusive = s21::intrusive_list<Connection, &Connection::hook>;
+using Pointers = s21::list<Connection*>;
+
+static Connection& get(Connection& connection) { return connection; }
+static Connection& get(Connection* connection) { return *connection; }
+
+static void link(Intrusive& list, Connection& connection) {
+  list.push_back(connection);
+}
+static void link(Pointers& list, Connection& connection) {
+  list.push_back(&connection);
+}
+
+template <typename List>
+static void run(const std::string& name, std::vector<Connection*>& order) {
+  size_t n = order.size();
+  List idle, active;
+  uint64_t sum = 0;
+  {
+    s21_bench::Timer timer;
+    for (Connection* connection : order) link(idle, *connection);
+    s21_bench::report(name + " push_back", n, timer.ms());
+  }
+  {
+    s21_bench::Timer timer;
+    for (auto it = idle.begin(); it != idle.end(); ++it) sum += get(*it).id;
+    s21_bench::report(name + " traverse", n, timer.ms());
+  }
+  {
+    s21_bench::Timer timer;
+    for (size_t i = 0; i < n; ++i) {
+      active.splice(active.end(), idle, idle.begin());
+    }
+    for (size_t i = 0; i < n; ++i) {
+      idle.splice(idle.end(), active, active.begin());
+    }
+    s21_bench::report(name + " move between lists", 2 * n, timer.ms());
+  }
+  {
+    s21_bench::Timer timer;
+    for (size_t i = 0; i < n; ++i) {
+      Connection& connection = get(idle.front());
+      idle.pop_front();
+      sum += connection.bytes[0];
+      link(active, connection);
+    }
+    s21_bench::report(name + " pop_front + push_back", n, timer.ms());
+  }
+  {
+    s21_bench::Timer timer;
+    active.clear();
+    s21_bench::report(name + " clear", n, timer.ms());
+  }
+  std::cout << "  sum: " << sum << std::endl;
+}
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 1000000);
+  std::vector<Connection> pool(n);
+  std::vector<Connection*> order(n);
+  for (size_t i = 0; i < n; ++i) {
+    pool[i].id = i;
+    order[i] = &pool[i];
+  }
+  run<Intrusive>("intrusive_list", order);
+  run<Pointers>("list<T*>", order);
+  std::shuffle(order.begin(), order.end(), std::mt19937_64(50));
+  run<Intrusive>("shuffled intrusive_list", order);
+  run<Pointers>("shuffled list<T*>", order);
+  return 0;
+}
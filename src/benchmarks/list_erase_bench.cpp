@@ -0,0 +1,57 @@
+// Erases every element of an n-element list in random order through saved
+// iterators, as an LRU or a scheduler unlinking its entries does, on
+// s21::list and std::list. Also inserts before random saved iterators and
+// erases the middle half of the list as one range.
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../lib/s21_list.h"
+#include "bench_util.h"
+
+template <typename List>
+static void run(const std::string& name, size_t n) {
+  std::mt19937_64 rng(41);
+  std::vector<size_t> order(n);
+  for (size_t i = 0; i < n; ++i) order[i] = i;
+  std::shuffle(order.begin(), order.end(), rng);
+
+  List list;
+  std::vector<typename List::iterator> positions;
+  positions.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    list.push_back(i);
+    positions.push_back(--list.end());
+  }
+  {
+    s21_bench::Timer timer;
+    for (size_t i : order) list.insert(positions[i], i);
+    s21_bench::report(name + " insert at random iterator", n, timer.ms());
+  }
+  {
+    s21_bench::Timer timer;
+    for (size_t i : order) list.erase(positions[i]);
+    s21_bench::report(name + " erase at random iterator", n, timer.ms());
+  }
+  auto first = list.begin();
+  for (size_t i = 0; i < n / 4; ++i) ++first;
+  auto last = first;
+  for (size_t i = 0; i < n / 2; ++i) ++last;
+  {
+    s21_bench::Timer timer;
+    list.erase(first, last);
+    s21_bench::report(name + " erase middle half as a range", n / 2,
+                      timer.ms());
+  }
+  std::cout << "  left: " << list.size() << std::endl;
+}
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 1000000);
+  run<s21::list<uint64_t>>("s21::list", n);
+  run<std::list<uint64_t>>("std::list", n);
+  return 0;
+}
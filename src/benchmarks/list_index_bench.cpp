@@ -0,0 +1,49 @@
+// Loops over s21::list by index: ascending, descending, a random index per
+// step and a random walk of short hops, with the default access (head,
+// tail or the last accessed node, whichever is nearest) and with the
+// checkpoint index of set_indexed(true).
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../lib/s21_list.h"
+#include "bench_util.h"
+
+static void run(const std::string& name, s21::list<uint64_t>& list,
+                const std::vector<size_t>& indices) {
+  uint64_t sum = 0;
+  s21_bench::Timer timer;
+  for (size_t index : indices) sum += list[index];
+  s21_bench::report(name, indices.size(), timer.ms());
+  std::cout << "  sum: " << sum << std::endl;
+}
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 1000000);
+  s21::list<uint64_t> list;
+  for (size_t i = 0; i < n; ++i) list.push_back(i);
+
+  std::mt19937_64 rng(48);
+  std::vector<size_t> ascending(n), descending(n), random(n / 100), hops(n);
+  for (size_t i = 0; i < n; ++i) {
+    ascending[i] = i;
+    descending[i] = n - 1 - i;
+  }
+  for (auto& index : random) index = rng() % n;
+  size_t at = n / 2;
+  for (auto& index : hops) {
+    at = (at + n + rng() % 21 - 10) % n;
+    index = at;
+  }
+
+  for (bool indexed : {false, true}) {
+    list.set_indexed(indexed);
+    std::string mode = indexed ? "indexed " : "";
+    run(mode + "ascending", list, ascending);
+    run(mode + "descending", list, descending);
+    run(mode + "random", list, random);
+    run(mode + "random hops of up to 10", list, hops);
+  }
+  return 0;
+}
@@ -0,0 +1,32 @@
+// Merges two sorted n-element lists, interleaved (evens and odds) and
+// disjoint (the whole of other after this), on s21::list and std::list.
+#include <cstdint>
+#include <list>
+#include <string>
+
+#include "../lib/s21_list.h"
+#include "bench_util.h"
+
+template <typename List>
+static void run(const std::string& name, size_t n, uint64_t other_step,
+                uint64_t other_offset) {
+  List list, other;
+  for (size_t i = 0; i < n; ++i) {
+    list.push_back(2 * i);
+    other.push_back(other_step * i + other_offset);
+  }
+  s21_bench::Timer timer;
+  list.merge(other);
+  s21_bench::report(name, 2 * n, timer.ms());
+  std::cout << "  size: " << list.size() << ", back: " << list.back()
+            << std::endl;
+}
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 1000000);
+  run<s21::list<uint64_t>>("s21::list merge interleaved", n, 2, 1);
+  run<std::list<uint64_t>>("std::list merge interleaved", n, 2, 1);
+  run<s21::list<uint64_t>>("s21::list merge disjoint", n, 1, 2 * n);
+  run<std::list<uint64_t>>("std::list merge disjoint", n, 1, 2 * n);
+  return 0;
+}
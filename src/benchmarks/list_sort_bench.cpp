@@ -0,0 +1,42 @@
+// list::sort on s21::list and std::list: random integers, random 64-byte
+// records (the sort relinks nodes, payloads never move) and an already
+// sorted list.
+#include <cstdint>
+#include <list>
+#include <random>
+#include <string>
+
+#include "../lib/s21_list.h"
+#include "bench_util.h"
+
+struct Record {
+  uint64_t key;
+  uint64_t payload[7];
+  bool operator<(const Record& other) const { return key < other.key; }
+  bool operator>(const Record& other) const { return key > other.key; }
+};
+
+template <typename List, typename Make>
+static void run(const std::string& name, size_t n, Make make) {
+  List list;
+  for (size_t i = 0; i < n; ++i) list.push_back(make(i));
+  s21_bench::Timer timer;
+  list.sort();
+  s21_bench::report(name, n, timer.ms());
+}
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 1000000);
+  std::mt19937_64 rng(42);
+  auto random_int = [&rng](size_t) { return rng(); };
+  auto random_record = [&rng](size_t) { return Record{rng() % 1000, {}}; };
+  auto ascending = [](size_t i) { return static_cast<uint64_t>(i); };
+
+  run<s21::list<uint64_t>>("s21::list sort random ints", n, random_int);
+  run<std::list<uint64_t>>("std::list sort random ints", n, random_int);
+  run<s21::list<Record>>("s21::list sort 64-byte records", n, random_record);
+  run<std::list<Record>>("std::list sort 64-byte records", n, random_record);
+  run<s21::list<uint64_t>>("s21::list sort sorted ints", n, ascending);
+  run<std::list<uint64_t>>("std::list sort sorted ints", n, ascending);
+  return 0;
+}
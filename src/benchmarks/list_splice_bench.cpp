@@ -0,0 +1,69 @@
+// Moving elements between two s21::list: n single tasks moved from a ready
+// list to a blocked list and back, by splice(pos, other, it) and by copying
+// the element with push_back and erase; then moving a run of 1000 elements
+// n / 1000 times by range splice with and without the count.
+#include <cstdint>
+#include <string>
+
+#include "../lib/s21_list.h"
+#include "bench_util.h"
+
+struct Task {
+  uint64_t id;
+  uint64_t state[7];
+};
+
+static void fill(s21::list<Task>& list, size_t n) {
+  for (size_t i = 0; i < n; ++i) list.push_back(Task{i, {}});
+}
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 1000000);
+  uint64_t sum = 0;
+  {
+    s21::list<Task> ready, blocked;
+    fill(ready, 1000);
+    s21_bench::Timer timer;
+    for (size_t i = 0; i < n; ++i) {
+      blocked.splice(blocked.end(), ready, ready.begin());
+      sum += blocked.back().id;
+      ready.splice(ready.end(), blocked, blocked.begin());
+    }
+    s21_bench::report("move one task, splice", 2 * n, timer.ms());
+  }
+  {
+    s21::list<Task> ready, blocked;
+    fill(ready, 1000);
+    s21_bench::Timer timer;
+    for (size_t i = 0; i < n; ++i) {
+      blocked.push_back(ready.front());
+      ready.erase(ready.begin());
+      sum += blocked.back().id;
+      ready.push_back(blocked.front());
+      blocked.erase(blocked.begin());
+    }
+    s21_bench::report("move one task, push_back + erase", 2 * n, timer.ms());
+  }
+  for (bool counted : {false, true}) {
+    s21::list<Task> from, to;
+    fill(from, 2000);
+    s21_bench::Timer timer;
+    size_t rounds = n / 1000;
+    for (size_t i = 0; i < rounds; ++i) {
+      auto last = from.begin();
+      for (int step = 0; step < 1000; ++step) ++last;
+      if (counted) {
+        to.splice(to.end(), from, from.begin(), last, 1000);
+      } else {
+        to.splice(to.end(), from, from.begin(), last);
+      }
+      from.splice(from.end(), to);
+    }
+    std::string name = counted ? "move 1000, range splice with count"
+                               : "move 1000, range splice";
+    s21_bench::report(name, rounds, timer.ms());
+    sum += from.size();
+  }
+  std::cout << "  sum: " << sum << std::endl;
+  return 0;
+}
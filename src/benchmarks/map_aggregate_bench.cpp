@@ -0,0 +1,61 @@
+// Sum of the values with key in a random [lo, hi) over a map of n random
+// keys: map::aggregate with the Sum monoid against a linear iteration that
+// stops at hi. Also times insert_or_assign with and without the monoid,
+// the cost of keeping the aggregates up to date.
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../lib/s21_map.h"
+#include "bench_util.h"
+
+using SumMap = s21::map<uint64_t, int64_t, s21::Sum<int64_t>>;
+using PlainMap = s21::map<uint64_t, int64_t>;
+
+template <typename Map>
+static void fill(Map& map, const std::vector<uint64_t>& keys,
+                 const char* name) {
+  s21_bench::Timer timer;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    map.insert_or_assign(keys[i], static_cast<int64_t>(i % 1000));
+  }
+  s21_bench::report(name, keys.size(), timer.ms());
+}
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 200000);
+  size_t queries = 200;
+  std::mt19937_64 rng(5);
+  std::vector<uint64_t> keys(n);
+  for (auto& key : keys) key = rng() % (4 * n);
+  std::vector<std::pair<uint64_t, uint64_t>> ranges(queries);
+  for (auto& range : ranges) {
+    uint64_t a = rng() % (4 * n);
+    uint64_t b = rng() % (4 * n);
+    range = a < b ? std::make_pair(a, b) : std::make_pair(b, a);
+  }
+
+  PlainMap plain;
+  fill(plain, keys, "insert_or_assign plain");
+  SumMap map;
+  fill(map, keys, "insert_or_assign with Sum");
+
+  int64_t scanned = 0;
+  s21_bench::Timer scan;
+  for (const auto& range : ranges) {
+    for (auto it = plain.begin(); it != plain.end(); ++it) {
+      if ((*it).first >= range.second) break;
+      if ((*it).first >= range.first) scanned += (*it).second;
+    }
+  }
+  s21_bench::report("linear scan range sum", queries, scan.ms());
+
+  int64_t aggregated = 0;
+  s21_bench::Timer aggregate;
+  for (const auto& range : ranges) {
+    aggregated += map.aggregate(range.first, range.second);
+  }
+  s21_bench::report("aggregate range sum", queries, aggregate.ms());
+  std::cout << "  sums: " << scanned << " " << aggregated << std::endl;
+  return scanned == aggregated ? 0 : 1;
+}
@@ -0,0 +1,97 @@
+// Startup cost of rebuilding an s21::set from a key file versus opening a
+// mapped_set image. Each variant runs in a child process; RSS growth is read
+// from /proc/self/statm (Linux), file-backed pages are reported separately
+// because the page cache shares them between processes.
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#include "../lib/s21_mapped_set.h"
+#include "../lib/s21_set.h"
+#include "bench_util.h"
+
+struct Rss {
+  long resident_kb = 0;
+  long shared_kb = 0;
+};
+
+static Rss current_rss() {
+  Rss rss;
+  long size = 0, resident = 0, shared = 0;
+  std::ifstream statm("/proc/self/statm");
+  if (statm >> size >> resident >> shared) {
+    long page_kb = sysconf(_SC_PAGESIZE) / 1024;
+    rss.resident_kb = resident * page_kb;
+    rss.shared_kb = shared * page_kb;
+  }
+  return rss;
+}
+
+template <typename Fn>
+static void run_isolated(const char* name, size_t n, Fn fn) {
+  pid_t pid = fork();
+  if (pid == 0) {
+    Rss before = current_rss();
+    s21_bench::Timer timer;
+    size_t hits = fn();
+    double ms = timer.ms();
+    Rss after = current_rss();
+    s21_bench::report(name, n, ms);
+    std::cout << "  hits: " << hits
+              << ", RSS growth: " << after.resident_kb - before.resident_kb
+              << " kB (file-backed: " << after.shared_kb - before.shared_kb
+              << " kB)" << std::endl;
+    _exit(0);
+  }
+  waitpid(pid, nullptr, 0);
+}
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 1000000);
+  std::string raw_path = "/tmp/s21_bench_keys.bin";
+  std::string image_path = "/tmp/s21_bench_keys.img";
+
+  std::vector<uint64_t> keys(n);
+  std::mt19937_64 rng(42);
+  for (auto& key : keys) key = rng();
+  {
+    std::ofstream out(raw_path, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(keys.data()),
+              keys.size() * sizeof(uint64_t));
+    // the parent does not build the set itself, so the children do not
+    // inherit its freed heap pages
+    std::vector<uint64_t> sorted(keys);
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    s21::mapped_set<uint64_t>::write(image_path, sorted.begin(), sorted.end());
+  }
+  const size_t probes = 1000;
+
+  run_isolated("rebuild s21::set from file + probes", n, [&] {
+    std::ifstream in(raw_path, std::ios::binary);
+    // kept alive until the child exits so that RSS is measured with it
+    auto* set = new s21::set<uint64_t>;
+    uint64_t key;
+    while (in.read(reinterpret_cast<char*>(&key), sizeof(key))) set->insert(key);
+    size_t hits = 0;
+    for (size_t i = 0; i < probes; ++i) hits += set->contains(keys[i * 7 % n]);
+    return hits;
+  });
+
+  run_isolated("open mapped_set image + probes", n, [&] {
+    auto* image = new s21::mapped_set<uint64_t>(image_path);
+    size_t hits = 0;
+    for (size_t i = 0; i < probes; ++i) hits += image->contains(keys[i * 7 % n]);
+    return hits;
+  });
+
+  std::remove(raw_path.c_str());
+  std::remove(image_path.c_str());
+  return 0;
+}
@@ -0,0 +1,91 @@
+// Memory and insert rate of s21::multimap and s21::grouped_multimap against
+// the map<Key, s21::vector<Value>> workaround, with 2 and with 8 values per
+// key on average, keys in random order. Also sums all values of random keys.
+#include <malloc.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../lib/s21_map.h"
+#include "../lib/s21_multimap.h"
+#include "bench_util.h"
+
+// bytes handed out by malloc, its rounding and headers included
+static size_t live_bytes() { return mallinfo2().uordblks; }
+
+struct MapOfVectors {
+  s21::map<uint64_t, s21::vector<uint64_t>> map;
+  void insert(uint64_t key, uint64_t value) { map[key].push_back(value); }
+  uint64_t sum(uint64_t key) {
+    auto it = map.find(key);
+    if (it == map.end()) return 0;
+    uint64_t result = 0;
+    auto& values = (*it).second;
+    for (size_t i = 0; i < values.size(); ++i) result += values[i];
+    return result;
+  }
+};
+
+struct Multimap {
+  s21::multimap<uint64_t, uint64_t> map;
+  void insert(uint64_t key, uint64_t value) { map.insert(key, value); }
+  uint64_t sum(uint64_t key) {
+    uint64_t result = 0;
+    auto range = map.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+      result += (*it).second;
+    }
+    return result;
+  }
+};
+
+struct Grouped {
+  s21::grouped_multimap<uint64_t, uint64_t> map;
+  void insert(uint64_t key, uint64_t value) { map.insert(key, value); }
+  uint64_t sum(uint64_t key) {
+    uint64_t result = 0;
+    auto range = map.equal_range(key);
+    for (auto value = range.first; value != range.second; ++value) {
+      result += *value;
+    }
+    return result;
+  }
+};
+
+template <typename Container>
+static void run(const std::string& name, const std::vector<uint64_t>& keys,
+                const std::vector<uint64_t>& probes) {
+  size_t before = live_bytes();
+  Container container;
+  {
+    s21_bench::Timer timer;
+    for (size_t i = 0; i < keys.size(); ++i) container.insert(keys[i], i);
+    s21_bench::report(name + " insert", keys.size(), timer.ms());
+  }
+  std::cout << "  bytes/value: "
+            << static_cast<double>(live_bytes() - before) / keys.size()
+            << std::endl;
+  uint64_t total = 0;
+  s21_bench::Timer timer;
+  for (uint64_t probe : probes) total += container.sum(probe);
+  s21_bench::report(name + " read key", probes.size(), timer.ms());
+  std::cout << "  sum: " << total << std::endl;
+}
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 1000000);
+  for (size_t per_key : {2, 8}) {
+    std::mt19937_64 rng(per_key);
+    size_t key_count = n / per_key;
+    std::vector<uint64_t> keys(n), probes(key_count);
+    for (auto& key : keys) key = rng() % key_count;
+    for (auto& probe : probes) probe = rng() % key_count;
+    std::string tag = std::to_string(per_key) + " per key: ";
+    run<MapOfVectors>(tag + "map of vectors", keys, probes);
+    run<Multimap>(tag + "multimap", keys, probes);
+    run<Grouped>(tag + "grouped_multimap", keys, probes);
+  }
+  return 0;
+}
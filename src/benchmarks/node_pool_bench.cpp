@@ -0,0 +1,93 @@
+// Push/pop throughput of s21::queue, s21::stack and s21::list with the
+// default per-container node pool against std::allocator, i.e. a new and a
+// delete per element as before the pool. Two patterns: fill n elements and
+// drain them, and a message queue holding about 1000 messages with n
+// push + pop pairs.
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "../lib/s21_list.h"
+#include "../lib/s21_queue.h"
+#include "../lib/s21_stack.h"
+#include "bench_util.h"
+
+struct Message {
+  uint64_t id;
+  uint64_t payload[3];
+};
+
+template <typename Queue>
+static void run_queue(const std::string& name, size_t n) {
+  Queue queue;
+  uint64_t sum = 0;
+  {
+    s21_bench::Timer timer;
+    for (size_t i = 0; i < n; ++i) queue.push(Message{i, {}});
+    for (size_t i = 0; i < n; ++i) {
+      sum += queue.front().id;
+      queue.pop();
+    }
+    s21_bench::report(name + " fill + drain", n, timer.ms());
+  }
+  {
+    for (size_t i = 0; i < 1000; ++i) queue.push(Message{i, {}});
+    s21_bench::Timer timer;
+    for (size_t i = 0; i < n; ++i) {
+      queue.push(Message{i, {}});
+      sum += queue.front().id;
+      queue.pop();
+    }
+    s21_bench::report(name + " steady push + pop", n, timer.ms());
+  }
+  std::cout << "  sum: " << sum << std::endl;
+}
+
+template <typename Stack>
+static void run_stack(const std::string& name, size_t n) {
+  Stack stack;
+  uint64_t sum = 0;
+  s21_bench::Timer timer;
+  for (size_t round = 0; round < 10; ++round) {
+    for (size_t i = 0; i < n / 10; ++i) stack.push(i);
+    for (size_t i = 0; i < n / 10; ++i) {
+      sum += stack.top();
+      stack.pop();
+    }
+  }
+  s21_bench::report(name + " push + pop in 10 rounds", n, timer.ms());
+  std::cout << "  sum: " << sum << std::endl;
+}
+
+template <typename List>
+static void run_list(const std::string& name, size_t n) {
+  List list;
+  uint64_t sum = 0;
+  s21_bench::Timer timer;
+  for (size_t i = 0; i < n; ++i) {
+    list.push_back(i);
+    list.push_front(i);
+    if (i % 4 == 3) {
+      sum += list.back() + list.front();
+      list.pop_back();
+      list.pop_front();
+      list.pop_back();
+    }
+  }
+  s21_bench::report(name + " push_back/front + pops", n, timer.ms());
+  std::cout << "  sum: " << sum << ", left: " << list.size() << std::endl;
+}
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 10000000);
+  run_queue<s21::queue<Message>>("queue, node pool", n);
+  run_queue<s21::queue<Message, std::allocator<Message>>>(
+      "queue, std::allocator", n);
+  run_stack<s21::stack<uint64_t>>("stack, node pool", n);
+  run_stack<s21::stack<uint64_t, std::allocator<uint64_t>>>(
+      "stack, std::allocator", n);
+  run_list<s21::list<uint64_t>>("list, node pool", n);
+  run_list<s21::list<uint64_t, std::allocator<uint64_t>>>(
+      "list, std::allocator", n);
+  return 0;
+}
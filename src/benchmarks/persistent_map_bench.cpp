@@ -0,0 +1,69 @@
+// Memory per version: a full s21::map copy per version versus a
+// persistent_map snapshot per version.
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "../lib/s21_map.h"
+#include "../lib/s21_persistent_map.h"
+#include "bench_util.h"
+
+static size_t g_live_bytes = 0;
+
+void* operator new(size_t size) {
+  size_t* p = static_cast<size_t*>(std::malloc(size + sizeof(size_t)));
+  if (p == nullptr) throw std::bad_alloc();
+  *p = size;
+  g_live_bytes += size;
+  return p + 1;
+}
+
+void operator delete(void* ptr) noexcept {
+  if (ptr == nullptr) return;
+  size_t* p = static_cast<size_t*>(ptr) - 1;
+  g_live_bytes -= *p;
+  std::free(p);
+}
+
+void operator delete(void* ptr, size_t) noexcept { operator delete(ptr); }
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 10000);
+  const size_t versions = 100;
+
+  {
+    s21::persistent_map<int, double> map;
+    for (size_t i = 0; i < n; ++i) map.insert((i * 7919) % n, i);
+    size_t base = g_live_bytes;
+    std::vector<s21::persistent_map<int, double>> history;
+    history.reserve(versions);
+    s21_bench::Timer timer;
+    for (size_t v = 0; v < versions; ++v) {
+      history.push_back(map);
+      map.insert_or_assign((v * 104729) % n, -1.0 * v);
+    }
+    double ms = timer.ms();
+    s21_bench::report("persistent_map snapshot+update", versions, ms);
+    std::cout << "  bytes per version: " << (g_live_bytes - base) / versions
+              << std::endl;
+  }
+
+  {
+    // copy_tree re-inserts every element into the new map
+    s21::map<int, double> map;
+    for (size_t i = 0; i < n; ++i) map.insert((i * 7919) % n, i);
+    size_t base = g_live_bytes;
+    std::vector<s21::map<int, double>> history;
+    history.reserve(versions);
+    s21_bench::Timer timer;
+    for (size_t v = 0; v < versions / 10; ++v) {
+      history.push_back(map);
+      map.insert_or_assign((v * 104729) % n, -1.0 * v);
+    }
+    double ms = timer.ms();
+    s21_bench::report("s21::map copy+update", versions / 10, ms);
+    std::cout << "  bytes per version: "
+              << (g_live_bytes - base) / (versions / 10) << std::endl;
+  }
+  return 0;
+}
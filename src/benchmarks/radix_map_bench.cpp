@@ -0,0 +1,83 @@
+// Memory and lookup speed of radix_map against s21::map on dense integer,
+// sparse integer and string (URL-like) keys.
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../lib/s21_map.h"
+#include "../lib/s21_radix_map.h"
+#include "bench_util.h"
+
+static size_t g_live_bytes = 0;
+
+void* operator new(size_t size) {
+  size_t* p = static_cast<size_t*>(std::malloc(size + sizeof(size_t)));
+  if (p == nullptr) throw std::bad_alloc();
+  *p = size;
+  g_live_bytes += size;
+  return p + 1;
+}
+
+void operator delete(void* ptr) noexcept {
+  if (ptr == nullptr) return;
+  size_t* p = static_cast<size_t*>(ptr) - 1;
+  g_live_bytes -= *p;
+  std::free(p);
+}
+
+void operator delete(void* ptr, size_t) noexcept { operator delete(ptr); }
+
+template <typename Map, typename Key>
+static void run(const std::string& name, const std::vector<Key>& keys,
+                const std::vector<Key>& probes) {
+  size_t before = g_live_bytes;
+  Map map;
+  {
+    s21_bench::Timer timer;
+    for (size_t i = 0; i < keys.size(); ++i) map.insert(keys[i], i);
+    s21_bench::report(name + " insert", keys.size(), timer.ms());
+  }
+  std::cout << "  bytes/element: "
+            << static_cast<double>(g_live_bytes - before) / keys.size()
+            << std::endl;
+  size_t hits = 0;
+  s21_bench::Timer timer;
+  for (const Key& probe : probes) hits += map.contains(probe);
+  s21_bench::report(name + " contains", probes.size(), timer.ms());
+  std::cout << "  hits: " << hits << std::endl;
+}
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 1000000);
+  std::mt19937_64 rng(5);
+
+  std::vector<uint64_t> dense(n), sparse(n), int_probes(n);
+  for (size_t i = 0; i < n; ++i) dense[i] = i;
+  std::shuffle(dense.begin(), dense.end(), rng);
+  for (auto& key : sparse) key = rng();
+  for (size_t i = 0; i < n; ++i) {
+    int_probes[i] = i % 2 ? dense[i] : sparse[rng() % n];
+  }
+
+  std::vector<std::string> urls(n), url_probes(n);
+  for (size_t i = 0; i < n; ++i) {
+    urls[i] = "https://example.com/users/" + std::to_string(rng() % (n * 4)) +
+              "/posts/" + std::to_string(i % 100);
+  }
+  for (size_t i = 0; i < n; ++i) url_probes[i] = urls[rng() % n];
+
+  run<s21::radix_map<uint64_t, uint64_t>>("radix_map dense", dense,
+                                          int_probes);
+  run<s21::map<uint64_t, uint64_t>>("map dense", dense, int_probes);
+  run<s21::radix_map<uint64_t, uint64_t>>("radix_map sparse", sparse,
+                                          int_probes);
+  run<s21::map<uint64_t, uint64_t>>("map sparse", sparse, int_probes);
+  run<s21::radix_map<std::string, uint64_t>>("radix_map strings", urls,
+                                             url_probes);
+  run<s21::map<std::string, uint64_t>>("map strings", urls, url_probes);
+  return 0;
+}
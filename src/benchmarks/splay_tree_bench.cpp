@@ -0,0 +1,87 @@
+// Lookups in s21::set with and without the SPLAY mode on four traces:
+// Zipf(0.99) and Zipf(1.4) over the keys (hot keys scattered over the key
+// space; with 1.4 about 1% of the keys get 90% of the hits), uniform random
+// keys and keys in ascending order. Both trees are built by the same
+// random insertions. Also inserts ascending keys, the worst case of the
+// unbalanced tree.
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../lib/s21_set.h"
+#include "bench_util.h"
+
+using Set = s21::set<uint64_t>;
+
+// samples ranks 0..n-1 with probability proportional to 1 / (rank + 1)^s
+static std::vector<uint64_t> zipf_trace(size_t keys, size_t count, double s) {
+  std::vector<double> cdf(keys);
+  double sum = 0;
+  for (size_t i = 0; i < keys; ++i) {
+    sum += 1.0 / std::pow(static_cast<double>(i + 1), s);
+    cdf[i] = sum;
+  }
+  std::vector<uint64_t> scatter(keys);
+  for (size_t i = 0; i < keys; ++i) scatter[i] = i;
+  std::mt19937_64 rng(3);
+  std::shuffle(scatter.begin(), scatter.end(), rng);
+  std::uniform_real_distribution<double> uniform(0.0, sum);
+  std::vector<uint64_t> trace(count);
+  for (auto& key : trace) {
+    size_t rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) -
+                  cdf.begin();
+    key = scatter[std::min(rank, keys - 1)];
+  }
+  return trace;
+}
+
+static void run(const std::string& name, Set::Balancing mode,
+                const std::vector<uint64_t>& inserts,
+                const std::vector<uint64_t>& trace) {
+  Set set(mode);
+  for (uint64_t key : inserts) set.insert(key);
+  size_t hits = 0;
+  s21_bench::Timer timer;
+  for (uint64_t key : trace) hits += set.contains(key);
+  s21_bench::report(name, trace.size(), timer.ms());
+  std::cout << "  hits: " << hits << std::endl;
+}
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 100000);
+  size_t ops = 10 * n;
+  std::vector<uint64_t> inserts(n);
+  for (size_t i = 0; i < n; ++i) inserts[i] = i;
+  std::mt19937_64 rng(7);
+  std::shuffle(inserts.begin(), inserts.end(), rng);
+
+  std::vector<uint64_t> uniform(ops);
+  for (auto& key : uniform) key = rng() % n;
+  std::vector<uint64_t> sequential(ops);
+  for (size_t i = 0; i < ops; ++i) sequential[i] = i % n;
+  std::vector<uint64_t> zipf = zipf_trace(n, ops, 0.99);
+  std::vector<uint64_t> skewed = zipf_trace(n, ops, 1.4);
+
+  for (Set::Balancing mode : {Set::UNBALANCED, Set::SPLAY}) {
+    std::string tag = mode == Set::SPLAY ? "splay" : "unbalanced";
+    run(tag + " zipf 0.99", mode, inserts, zipf);
+    run(tag + " zipf 1.4", mode, inserts, skewed);
+    run(tag + " uniform", mode, inserts, uniform);
+    run(tag + " sequential", mode, inserts, sequential);
+  }
+
+  // ascending insertions make the unbalanced tree a list
+  size_t small = n / 5;
+  for (Set::Balancing mode : {Set::UNBALANCED, Set::SPLAY}) {
+    Set set(mode);
+    s21_bench::Timer timer;
+    for (uint64_t key = 0; key < small; ++key) set.insert(key);
+    s21_bench::report(std::string(mode == Set::SPLAY ? "splay" : "unbalanced") +
+                          " ascending insert",
+                      small, timer.ms());
+  }
+  return 0;
+}
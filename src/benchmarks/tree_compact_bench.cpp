@@ -0,0 +1,62 @@
+// Full scan and lookups of a map whose nodes are scattered over the heap by
+// random inserts and erases, before and after compact(). Also times
+// compact() itself and the incremental compact_step.
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../lib/s21_map.h"
+#include "bench_util.h"
+
+static void measure(const char* name, s21::map<uint64_t, uint64_t>& map,
+                    const std::vector<uint64_t>& probes) {
+  uint64_t sum = 0;
+  s21_bench::Timer scan;
+  for (int round = 0; round < 5; ++round) {
+    for (auto it = map.begin(); it != map.end(); ++it) sum += (*it).second;
+  }
+  s21_bench::report(std::string(name) + " scan", 5 * map.size(), scan.ms());
+  s21_bench::Timer find;
+  for (uint64_t key : probes) sum += map.contains(key);
+  s21_bench::report(std::string(name) + " contains", probes.size(),
+                    find.ms());
+  std::cout << "  checksum: " << sum << std::endl;
+}
+
+// churn: the surviving nodes end up spread over all the allocations
+static void fill(s21::map<uint64_t, uint64_t>& map, size_t n) {
+  std::mt19937_64 rng(13);
+  for (size_t i = 0; i < 3 * n; ++i) map.insert(rng() % (8 * n), i);
+  std::vector<uint64_t> erase;
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    if (rng() % 3 != 0) erase.push_back((*it).first);
+  }
+  for (uint64_t key : erase) map.erase(map.find(key));
+}
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 200000);
+  std::mt19937_64 rng(17);
+  std::vector<uint64_t> probes(n);
+  for (auto& probe : probes) probe = rng() % (8 * n);
+  {
+    // the copy constructor would insert in order and degenerate the tree
+    s21::map<uint64_t, uint64_t> map;
+    fill(map, n);
+    s21_bench::Timer timer;
+    size_t steps = 1;
+    while (!map.compact_step(4096)) ++steps;
+    s21_bench::report("compact_step(4096) x" + std::to_string(steps),
+                      map.size(), timer.ms());
+  }
+
+  s21::map<uint64_t, uint64_t> map;
+  fill(map, n);
+  measure("scattered", map, probes);
+  s21_bench::Timer timer;
+  map.compact();
+  s21_bench::report("compact", map.size(), timer.ms());
+  measure("compacted", map, probes);
+  return 0;
+}
@@ -0,0 +1,50 @@
+// Insert, lookup (hits and misses) and erase of unordered_map against
+// s21::map and std::unordered_map with random 64-bit keys.
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../lib/s21_map.h"
+#include "../lib/s21_unordered_map.h"
+#include "bench_util.h"
+
+template <typename Map>
+static void run(const std::string& name, const std::vector<uint64_t>& keys,
+                const std::vector<uint64_t>& probes) {
+  Map map;
+  {
+    s21_bench::Timer timer;
+    for (size_t i = 0; i < keys.size(); ++i) map.insert({keys[i], i});
+    s21_bench::report(name + " insert", keys.size(), timer.ms());
+  }
+  size_t hits = 0;
+  {
+    s21_bench::Timer timer;
+    for (uint64_t probe : probes) hits += map.find(probe) != map.end();
+    s21_bench::report(name + " find", probes.size(), timer.ms());
+  }
+  {
+    s21_bench::Timer timer;
+    for (uint64_t key : keys) map.erase(map.find(key));
+    s21_bench::report(name + " erase", keys.size(), timer.ms());
+  }
+  std::cout << "  hits: " << hits << std::endl;
+}
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 1000000);
+  std::mt19937_64 rng(7);
+  std::vector<uint64_t> keys(n), probes(n);
+  for (auto& key : keys) key = rng();
+  // half of the probes hit
+  for (size_t i = 0; i < n; ++i) probes[i] = i % 2 ? keys[rng() % n] : rng();
+
+  run<s21::unordered_map<uint64_t, uint64_t>>("s21::unordered_map", keys,
+                                              probes);
+  run<std::unordered_map<uint64_t, uint64_t>>("std::unordered_map", keys,
+                                              probes);
+  run<s21::map<uint64_t, uint64_t>>("s21::map", keys, probes);
+  return 0;
+}
@@ -0,0 +1,89 @@
+// s21::unrolled_list (256-byte chunks, and 1024-byte chunks for the larger
+// payloads) against s21::list for int, 64-byte and 256-byte elements:
+// push_back of n elements, a full traversal, an insert after every second
+// element while traversing and sort.
+#include <cstdint>
+#include <random>
+#include <string>
+#include <type_traits>
+
+#include "../lib/s21_list.h"
+#include "../lib/s21_unrolled_list.h"
+#include "bench_util.h"
+
+template <size_t Bytes>
+struct Payload {
+  uint64_t key;
+  unsigned char rest[Bytes - sizeof(uint64_t)];
+  bool operator<(const Payload& other) const { return key < other.key; }
+};
+
+template <typename T>
+static T make(uint64_t key) {
+  if constexpr (std::is_same_v<T, int>) {
+    return static_cast<int>(key);
+  } else {
+    T value{};
+    value.key = key;
+    return value;
+  }
+}
+
+template <typename T>
+static uint64_t key_of(const T& value) {
+  if constexpr (std::is_same_v<T, int>) {
+    return value;
+  } else {
+    return value.key;
+  }
+}
+
+template <typename List>
+static void run(const std::string& name, size_t n) {
+  using T = typename List::value_type;
+  std::mt19937_64 rng(46);
+  List list;
+  {
+    s21_bench::Timer timer;
+    for (size_t i = 0; i < n; ++i) list.push_back(make<T>(rng() % n));
+    s21_bench::report(name + " push_back", n, timer.ms());
+  }
+  uint64_t sum = 0;
+  {
+    s21_bench::Timer timer;
+    for (auto it = list.begin(); it != list.end(); ++it) sum += key_of(*it);
+    s21_bench::report(name + " traverse", n, timer.ms());
+  }
+  {
+    s21_bench::Timer timer;
+    size_t inserted = 0;
+    for (auto it = list.begin(); it != list.end(); ++inserted) {
+      ++it;
+      if (it == list.end()) break;
+      it = list.insert(it, make<T>(inserted));
+      ++it;
+      ++it;
+    }
+    s21_bench::report(name + " insert every 2nd", inserted, timer.ms());
+  }
+  {
+    s21_bench::Timer timer;
+    list.sort();
+    s21_bench::report(name + " sort", list.size(), timer.ms());
+  }
+  std::cout << "  sum: " << sum << ", size: " << list.size() << std::endl;
+}
+
+int main(int argc, char** argv) {
+  size_t n = s21_bench::arg_size(argc, argv, 1000000);
+  run<s21::list<int>>("int list", n);
+  run<s21::unrolled_list<int>>("int unrolled_list", n);
+  run<s21::list<Payload<64>>>("64B list", n);
+  run<s21::unrolled_list<Payload<64>>>("64B unrolled_list", n);
+  run<s21::unrolled_list<Payload<64>, 1024>>("64B unrolled_list<1024>", n);
+  run<s21::list<Payload<256>>>("256B list", n / 4);
+  run<s21::unrolled_list<Payload<256>>>("256B unrolled_list", n / 4);
+  run<s21::unrolled_list<Payload<256>, 1024>>("256B unrolled_list<1024>",
+                                              n / 4);
+  return 0;
+}
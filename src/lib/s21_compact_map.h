@@ -0,0 +1,99 @@
+#ifndef S21_COMPACT_MAP_H
+#define S21_COMPACT_MAP_H
+
+#include <stdexcept>
+#include <utility>  // Для std::pair
+#include <vector>
+
+#include "s21_compact_tree.h"
+
+namespace s21 {
+
+// map with the nodes in a CompactTree arena linked by 32-bit indices.
+template <typename Key, typename Value>
+class compact_map : public CompactTree<std::pair<Key, Value>> {
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<const Key, Value>;
+  using tree_type = CompactTree<std::pair<Key, Value>>;
+  using iterator = typename tree_type::Iterator;
+  using const_iterator = typename tree_type::ConstIterator;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+
+  using tree_type::tree_type;
+
+  std::pair<iterator, bool> insert(const std::pair<const Key, Value>& value) {
+    return this->insert_tree(value, tree_type::INSERT_NO_DUPLICATE);
+  }
+
+  std::pair<iterator, bool> insert(const Key& key, const Value& obj) {
+    return this->insert_tree(std::make_pair(key, obj),
+                             tree_type::INSERT_NO_DUPLICATE);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const Value& obj) {
+    return this->insert_tree(std::make_pair(key, obj),
+                             tree_type::INSERT_WITH_UPDATE);
+  }
+
+  iterator find(const Key& key) { return iterator(find_key(key), this); }
+
+  // Доступ к элементу по ключу
+  Value& at(const Key& key) {
+    iterator it = find(key);
+    if (it == this->end()) {
+      throw std::out_of_range("Key not found");
+    }
+    return (*it).second;
+  }
+
+  // Доступ или вставка элемента по заданному ключу
+  Value& operator[](const Key& key) {
+    iterator it = find(key);
+    if (it == this->end()) {
+      it = this->insert_tree(std::make_pair(key, Value{}),
+                             tree_type::INSERT_NO_DUPLICATE)
+               .first;
+    }
+    return (*it).second;
+  }
+
+  bool contains(const Key& key) const {
+    return find_key(key) != tree_type::kNil;
+  }
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    std::vector<std::pair<iterator, bool>> results;
+    (void)(results.push_back(this->insert(std::forward<Args>(args))), ...);
+    return results;
+  }
+
+ protected:
+  // the search compares keys only, Value needs no operator>
+  typename tree_type::index_type find_key(const Key& key) const {
+    typename tree_type::index_type current = this->root_;
+    while (current != tree_type::kNil) {
+      const Key& stored = this->nodes_[current].data.first;
+      if (key > stored) {
+        current = this->nodes_[current].right;
+      } else if (stored > key) {
+        current = this->nodes_[current].left;
+      } else {
+        break;
+      }
+    }
+    return current;
+  }
+
+  bool const_comparator(const std::pair<Key, Value>& data1,
+                        const std::pair<Key, Value>& data2) const override {
+    return data1.first > data2.first;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_COMPACT_MAP_H
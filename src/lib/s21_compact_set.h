@@ -0,0 +1,47 @@
+#ifndef S21_COMPACT_SET_H
+#define S21_COMPACT_SET_H
+
+#include <utility>  // Для std::pair
+#include <vector>
+
+#include "s21_compact_tree.h"
+
+namespace s21 {
+
+// set with the nodes in a CompactTree arena linked by 32-bit indices.
+template <typename Key>
+class compact_set : public CompactTree<Key> {
+ public:
+  using key_type = Key;
+  using value_type = key_type;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using tree_type = CompactTree<key_type>;
+  using iterator = typename tree_type::Iterator;
+  using const_iterator = typename tree_type::ConstIterator;
+
+  using tree_type::tree_type;
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return this->insert_tree(value, tree_type::INSERT_NO_DUPLICATE);
+  }
+
+  iterator find(const Key& key) {
+    return iterator(this->find_index(key), this);
+  }
+
+  bool contains(const Key& key) const {
+    return this->find_index(key) != tree_type::kNil;
+  }
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    std::vector<std::pair<iterator, bool>> results;
+    (void)(results.push_back(this->insert(std::forward<Args>(args))), ...);
+    return results;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_COMPACT_SET_H
@@ -0,0 +1,418 @@
+#ifndef S21_COMPACT_TREE_H
+#define S21_COMPACT_TREE_H
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>  // Для std::pair
+#include <vector>
+
+#include "s21_container.h"
+#include "s21_tree.h"  // TreeOrdered, TreeKeyValue
+
+namespace s21 {
+
+// The same binary search tree as Tree, with the nodes stored in one growable
+// array and linked by 32-bit indices instead of 64-bit pointers. A node of a
+// set<int> shrinks from 32 bytes plus the malloc header to 16 bytes, and
+// neighbours allocated together stay close in memory.
+//
+// Index 0 is the null link, slot 0 of the array is never used. Erased slots
+// are chained through `left` and reused by later insertions, their data is
+// overwritten on reuse. Iterators are indices, so they stay valid when the
+// array grows.
+template <typename DataType>
+class CompactTree : public Container<DataType> {
+ public:
+  using size_type = std::size_t;
+  using index_type = uint32_t;
+  struct Node;
+  class Iterator;
+  class ConstIterator;
+
+  CompactTree() : nodes_(1) {}
+  CompactTree(std::initializer_list<DataType> const& items);
+  CompactTree(const CompactTree& other) = default;
+  CompactTree(CompactTree&& other) : CompactTree() { swap(other); }
+  virtual ~CompactTree() = default;
+
+  CompactTree& operator=(const CompactTree& other) = default;
+  CompactTree& operator=(CompactTree&& other) {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  Iterator begin() { return Iterator(find_min(root_), this); }
+  Iterator end() { return Iterator(kNil, this); }
+  ConstIterator begin() const { return ConstIterator(find_min(root_), this); }
+  ConstIterator end() const { return ConstIterator(kNil, this); }
+
+  void erase(Iterator pos);
+  void clear() {
+    nodes_.resize(1);
+    root_ = free_ = kNil;
+    this->count_ = 0;
+  }
+  void swap(CompactTree& other) {
+    nodes_.swap(other.nodes_);
+    std::swap(root_, other.root_);
+    std::swap(free_, other.free_);
+    std::swap(this->count_, other.count_);
+  }
+  void merge(CompactTree& other);
+  // replaces the contents with count sorted elements read from first
+  template <typename InputIt>
+  void build_sorted(InputIt first, size_type count);
+  // preallocates slots for count elements
+  void reserve(size_type count) { nodes_.reserve(count + 1); }
+  // bytes held by the node array, including unused capacity
+  size_type memory_usage() const { return nodes_.capacity() * sizeof(Node); }
+
+  size_type max_size() override {
+    return std::numeric_limits<index_type>::max() - 1;
+  }
+
+ protected:
+  enum InsertMode {
+    INSERT_NO_DUPLICATE = 1,  // Insert without duplicates and without updating
+    INSERT_WITH_UPDATE = 2,   // Inserting and updating an existing element
+    INSERT_DUPLICATES = 3     // Inserting duplicates
+  };
+  static constexpr index_type kNil = 0;
+
+  std::pair<Iterator, bool> insert_tree(const DataType& data, int mode);
+  index_type find_index(const DataType& data) const;
+  index_type find_min(index_type node) const;
+  index_type find_max(index_type node) const;
+  index_type next(index_type node) const;
+  index_type prev(index_type node) const;
+  index_type make_node(const DataType& data, index_type parent);
+  template <typename InputIt>
+  index_type build_subtree(InputIt& it, size_type count, index_type parent);
+
+  virtual bool const_comparator(const DataType& data1,
+                                const DataType& data2) const {
+    if constexpr (TreeOrdered<DataType>::value) {
+      return data1 > data2;
+    } else {
+      // compact_map compares keys only and overrides this
+      static_assert(TreeKeyValue<DataType>::value,
+                    "CompactTree elements must be comparable with operator>");
+      return false;
+    }
+  }
+
+  std::vector<Node> nodes_;
+  index_type root_ = kNil;
+  index_type free_ = kNil;  // head of the chain of erased slots
+};
+
+// ---------------------------------- Node ---------------------------------
+template <typename DataType>
+struct CompactTree<DataType>::Node {
+  DataType data;
+  index_type left = kNil;
+  index_type right = kNil;
+  index_type parent = kNil;
+
+  Node() = default;
+  Node(const DataType& data, index_type p) : data(data), parent(p) {}
+};
+
+// ---------------------------------- Iterator ---------------------------------
+template <typename DataType>
+class CompactTree<DataType>::Iterator {
+ public:
+  Iterator(index_type node, CompactTree* tree) : current_(node), tree_(tree) {}
+  DataType& operator*() const { return tree_->nodes_[current_].data; }
+  DataType* operator->() const { return &tree_->nodes_[current_].data; }
+  Iterator& operator++() {
+    current_ = current_ == kNil ? tree_->find_min(tree_->root_)
+                                : tree_->next(current_);
+    return *this;
+  }
+  Iterator operator++(int) {
+    Iterator tmp(*this);
+    ++(*this);
+    return tmp;
+  }
+  Iterator& operator--() {
+    current_ = current_ == kNil ? tree_->find_max(tree_->root_)
+                                : tree_->prev(current_);
+    return *this;
+  }
+  Iterator operator--(int) {
+    Iterator tmp(*this);
+    --(*this);
+    return tmp;
+  }
+  bool operator==(const Iterator& other) const {
+    return current_ == other.current_;
+  }
+  bool operator!=(const Iterator& other) const {
+    return current_ != other.current_;
+  }
+  index_type index() const { return current_; }
+
+ protected:
+  index_type current_;
+  CompactTree* tree_;
+};
+
+template <typename DataType>
+class CompactTree<DataType>::ConstIterator {
+ public:
+  ConstIterator(index_type node, const CompactTree* tree)
+      : current_(node), tree_(tree) {}
+  const DataType& operator*() const { return tree_->nodes_[current_].data; }
+  const DataType* operator->() const { return &tree_->nodes_[current_].data; }
+  ConstIterator& operator++() {
+    current_ = current_ == kNil ? tree_->find_min(tree_->root_)
+                                : tree_->next(current_);
+    return *this;
+  }
+  ConstIterator operator++(int) {
+    ConstIterator tmp(*this);
+    ++(*this);
+    return tmp;
+  }
+  ConstIterator& operator--() {
+    current_ = current_ == kNil ? tree_->find_max(tree_->root_)
+                                : tree_->prev(current_);
+    return *this;
+  }
+  ConstIterator operator--(int) {
+    ConstIterator tmp(*this);
+    --(*this);
+    return tmp;
+  }
+  bool operator==(const ConstIterator& other) const {
+    return current_ == other.current_;
+  }
+  bool operator!=(const ConstIterator& other) const {
+    return current_ != other.current_;
+  }
+
+ protected:
+  index_type current_;
+  const CompactTree* tree_;
+};
+
+template <typename DataType>
+constexpr
+    typename CompactTree<DataType>::index_type CompactTree<DataType>::kNil;
+
+// -------------------- constructors and destructors ------------------------
+template <typename DataType>
+CompactTree<DataType>::CompactTree(std::initializer_list<DataType> const& items)
+    : CompactTree() {
+  for (const auto& item : items) {
+    insert_tree(item, INSERT_DUPLICATES);
+  }
+}
+
+// ----------------------------  methods  ------------------------------
+
+template <typename DataType>
+typename CompactTree<DataType>::index_type CompactTree<DataType>::find_min(
+    index_type node) const {
+  if (node == kNil) return kNil;
+  while (nodes_[node].left != kNil) node = nodes_[node].left;
+  return node;
+}
+
+template <typename DataType>
+typename CompactTree<DataType>::index_type CompactTree<DataType>::find_max(
+    index_type node) const {
+  if (node == kNil) return kNil;
+  while (nodes_[node].right != kNil) node = nodes_[node].right;
+  return node;
+}
+
+template <typename DataType>
+typename CompactTree<DataType>::index_type CompactTree<DataType>::next(
+    index_type node) const {
+  if (nodes_[node].right != kNil) return find_min(nodes_[node].right);
+  index_type parent = nodes_[node].parent;
+  while (parent != kNil && node == nodes_[parent].right) {
+    node = parent;
+    parent = nodes_[parent].parent;
+  }
+  return parent;
+}
+
+template <typename DataType>
+typename CompactTree<DataType>::index_type CompactTree<DataType>::prev(
+    index_type node) const {
+  if (nodes_[node].left != kNil) return find_max(nodes_[node].left);
+  index_type parent = nodes_[node].parent;
+  while (parent != kNil && node == nodes_[parent].left) {
+    node = parent;
+    parent = nodes_[parent].parent;
+  }
+  return parent;
+}
+
+template <typename DataType>
+typename CompactTree<DataType>::index_type CompactTree<DataType>::make_node(
+    const DataType& data, index_type parent) {
+  index_type node = free_;
+  if (node != kNil) {
+    free_ = nodes_[node].left;
+    nodes_[node].data = data;
+    nodes_[node].left = nodes_[node].right = kNil;
+    nodes_[node].parent = parent;
+  } else {
+    if (nodes_.size() > max_size()) {
+      throw std::length_error("CompactTree: too many nodes");
+    }
+    node = static_cast<index_type>(nodes_.size());
+    nodes_.emplace_back(data, parent);
+  }
+  return node;
+}
+
+template <typename DataType>
+std::pair<typename CompactTree<DataType>::Iterator, bool>
+CompactTree<DataType>::insert_tree(const DataType& data, int mode) {
+  index_type current = root_;
+  index_type parent = kNil;
+  bool isLeft = false;
+
+  while (current != kNil) {
+    parent = current;
+    const DataType& value = nodes_[current].data;
+    if (!const_comparator(data, value) && !const_comparator(value, data)) {
+      if (mode == INSERT_WITH_UPDATE) {
+        nodes_[current].data = data;
+        return {Iterator(current, this), false};
+      } else if (mode == INSERT_NO_DUPLICATE) {
+        return {Iterator(current, this), false};
+      }
+      isLeft = false;
+      current = nodes_[current].right;
+    } else if (const_comparator(data, value)) {
+      isLeft = false;
+      current = nodes_[current].right;
+    } else {
+      isLeft = true;
+      current = nodes_[current].left;
+    }
+  }
+
+  // make_node may reallocate the array, take no references across it
+  index_type node = make_node(data, parent);
+  if (parent == kNil) {
+    root_ = node;
+  } else if (isLeft) {
+    nodes_[parent].left = node;
+  } else {
+    nodes_[parent].right = node;
+  }
+  this->count_++;
+  return {Iterator(node, this), true};
+}
+
+template <typename DataType>
+typename CompactTree<DataType>::index_type CompactTree<DataType>::find_index(
+    const DataType& data) const {
+  index_type current = root_;
+  while (current != kNil) {
+    if (const_comparator(data, nodes_[current].data)) {
+      current = nodes_[current].right;
+    } else if (const_comparator(nodes_[current].data, data)) {
+      current = nodes_[current].left;
+    } else {
+      break;
+    }
+  }
+  return current;
+}
+
+template <typename DataType>
+void CompactTree<DataType>::erase(Iterator pos) {
+  index_type node = pos.index();
+  if (node == kNil) return;
+
+  auto replace_child = [this](index_type parent, index_type old_child,
+                              index_type new_child) {
+    if (parent == kNil) {
+      root_ = new_child;
+    } else if (nodes_[parent].left == old_child) {
+      nodes_[parent].left = new_child;
+    } else {
+      nodes_[parent].right = new_child;
+    }
+    if (new_child != kNil) nodes_[new_child].parent = parent;
+  };
+
+  Node& target = nodes_[node];
+  if (target.left == kNil || target.right == kNil) {
+    index_type child = target.left != kNil ? target.left : target.right;
+    replace_child(target.parent, node, child);
+  } else {
+    // like Tree: the successor's data moves up, the successor slot is freed
+    index_type successor = find_min(target.right);
+    target.data = nodes_[successor].data;
+    replace_child(nodes_[successor].parent, successor,
+                  nodes_[successor].right);
+    node = successor;
+  }
+
+  nodes_[node].left = free_;
+  nodes_[node].right = nodes_[node].parent = kNil;
+  free_ = node;
+  --this->count_;
+}
+
+template <typename DataType>
+void CompactTree<DataType>::merge(CompactTree& other) {
+  if (this == &other) return;
+  Iterator it = other.begin();
+  while (it != other.end()) {
+    if (find_index(*it) == kNil) {
+      insert_tree(*it, INSERT_NO_DUPLICATE);
+      Iterator del = it++;
+      const Node& node = other.nodes_[del.index()];
+      bool two_children = node.left != kNil && node.right != kNil;
+      other.erase(del);
+      // the successor's data has moved into the erased slot
+      if (two_children) it = del;
+    } else {
+      ++it;
+    }
+  }
+}
+
+template <typename DataType>
+template <typename InputIt>
+void CompactTree<DataType>::build_sorted(InputIt first, size_type count) {
+  clear();
+  nodes_.reserve(count + 1);
+  root_ = build_subtree(first, count, kNil);
+  this->count_ = count;
+}
+
+// the left half is read first, so the input is consumed strictly in order
+template <typename DataType>
+template <typename InputIt>
+typename CompactTree<DataType>::index_type CompactTree<DataType>::build_subtree(
+    InputIt& it, size_type count, index_type parent) {
+  if (count == 0) return kNil;
+  size_type left_count = count / 2;
+  index_type left = build_subtree(it, left_count, kNil);
+  index_type node = make_node(*it, parent);
+  ++it;
+  nodes_[node].left = left;
+  if (left != kNil) nodes_[left].parent = node;
+  index_type right = build_subtree(it, count - left_count - 1, node);
+  nodes_[node].right = right;
+  return node;
+}
+
+}  // namespace s21
+
+#endif  // S21_COMPACT_TREE_H
@@ -0,0 +1,397 @@
+#ifndef S21_CONCURRENT_UNORDERED_MAP_H
+#define S21_CONCURRENT_UNORDERED_MAP_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>  // Для std::pair
+#include <vector>
+
+#include "s21_epoch.h"
+
+namespace s21 {
+
+// Hash map shared between threads.
+//
+// The keys are spread over independent segments by the high bits of the
+// hash. A segment is a table of bucket chains behind an atomic pointer.
+// Nodes are immutable once published: writers lock only their segment,
+// replace a node by a new one (insert_or_assign, update) or unlink it
+// (erase), and a full segment is resized by building a new table aside and
+// publishing it with one store. Readers take no locks and never wait: they
+// follow the atomic pointers inside an epoch guard, and unlinked nodes and
+// tables are freed only after every reader that could see them has left
+// (see EpochDomain).
+//
+// Lookups return copies of the values. There are no iterators, for_each
+// visits a weakly consistent view of the map.
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class concurrent_unordered_map {
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<const Key, Value>;
+  using size_type = size_t;
+
+  // segments defaults to 8 per hardware thread, rounded up to a power of two
+  explicit concurrent_unordered_map(size_type segments = 0);
+  ~concurrent_unordered_map();
+  concurrent_unordered_map(const concurrent_unordered_map&) = delete;
+  concurrent_unordered_map& operator=(const concurrent_unordered_map&) =
+      delete;
+
+  // returns false if the key is already there
+  bool insert(const Key& key, const Value& obj);
+  // returns true if the key was inserted, false if the value was replaced
+  bool insert_or_assign(const Key& key, const Value& obj);
+  // atomically replaces the value by fn(value), false if there is no key.
+  // fn runs under the segment lock and must not use the map.
+  template <typename Fn>
+  bool update(const Key& key, Fn fn);
+  size_type erase(const Key& key);
+  void clear();
+
+  // copies the value to out, false if there is no key
+  bool find(const Key& key, Value& out) const;
+  // Доступ к элементу по ключу
+  Value at(const Key& key) const {
+    Value result;
+    if (!find(key, result)) throw std::out_of_range("Key not found");
+    return result;
+  }
+  bool contains(const Key& key) const;
+
+  template <typename Fn>
+  void for_each(Fn fn) const;
+
+  size_type size() const { return count_.load(std::memory_order_relaxed); }
+  bool empty() const { return size() == 0; }
+  size_type segment_count() const { return segments_.size(); }
+
+ protected:
+  struct Node {
+    Node(const Key& k, const Value& v, size_t h, Node* n)
+        : data(k, v), hash(h), next(n) {}
+    const std::pair<const Key, Value> data;
+    const size_t hash;
+    std::atomic<Node*> next;
+  };
+
+  struct Table {
+    explicit Table(size_type n) : mask(n - 1), buckets(n) {}
+    const size_type mask;
+    std::vector<std::atomic<Node*>> buckets;
+  };
+
+  struct Retired {
+    uint64_t epoch;
+    Node* node;
+    Table* table;
+  };
+
+  struct alignas(64) Segment {
+    std::mutex lock;
+    std::atomic<Table*> table{nullptr};
+    size_type count = 0;  // guarded by lock
+    std::vector<Retired> retired;
+  };
+
+  static constexpr size_type kInitialBuckets = 16;
+  // free retired objects every this many retirements
+  static constexpr size_type kReclaimBatch = 64;
+
+  static size_type segment_count_for(size_type segments) {
+    if (segments == 0) {
+      segments = 8 * std::max(1u, std::thread::hardware_concurrency());
+    }
+    size_type count = 1;
+    while (count < segments) count *= 2;
+    return count;
+  }
+
+  size_t hash(const Key& key) const {
+    uint64_t h = static_cast<uint64_t>(hasher_(key)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(h ^ (h >> 29));
+  }
+  Segment& segment_of(size_t h) const {
+    return segments_[(h >> 40) & (segments_.size() - 1)];
+  }
+  // node with the key in a published table, nullptr if there is none
+  static Node* find_node(const Table* table, const Key& key, size_t h);
+  // the link that points to the node with the key, or the null link at the
+  // end of its chain; segment lock held
+  static std::atomic<Node*>* find_link(Table* table, const Key& key, size_t h);
+
+  // all the writers below hold the segment lock
+  Table* table_for_insert(Segment& segment);
+  void retire(Segment& segment, Node* node, Table* table);
+  void reclaim(Segment& segment, bool all);
+  static void free_chain(Table* table);
+
+  mutable std::vector<Segment> segments_;
+  std::atomic<size_type> count_{0};
+  EpochDomain epochs_;
+  Hash hasher_;
+};
+
+template <typename Key, typename Value, typename Hash>
+constexpr typename concurrent_unordered_map<Key, Value, Hash>::size_type
+    concurrent_unordered_map<Key, Value, Hash>::kInitialBuckets;
+template <typename Key, typename Value, typename Hash>
+constexpr typename concurrent_unordered_map<Key, Value, Hash>::size_type
+    concurrent_unordered_map<Key, Value, Hash>::kReclaimBatch;
+
+// -------------------- constructors and destructors ------------------------
+template <typename Key, typename Value, typename Hash>
+concurrent_unordered_map<Key, Value, Hash>::concurrent_unordered_map(
+    size_type segments)
+    : segments_(segment_count_for(segments)) {}
+
+template <typename Key, typename Value, typename Hash>
+concurrent_unordered_map<Key, Value, Hash>::~concurrent_unordered_map() {
+  for (auto& segment : segments_) {
+    reclaim(segment, true);
+    Table* table = segment.table.load(std::memory_order_relaxed);
+    if (table != nullptr) {
+      free_chain(table);
+      delete table;
+    }
+  }
+}
+
+// ----------------------------  methods  ------------------------------
+
+template <typename Key, typename Value, typename Hash>
+typename concurrent_unordered_map<Key, Value, Hash>::Node*
+concurrent_unordered_map<Key, Value, Hash>::find_node(const Table* table,
+                                                      const Key& key,
+                                                      size_t h) {
+  if (table == nullptr) return nullptr;
+  Node* node = table->buckets[h & table->mask].load(std::memory_order_acquire);
+  while (node != nullptr && !(node->hash == h && node->data.first == key)) {
+    node = node->next.load(std::memory_order_acquire);
+  }
+  return node;
+}
+
+template <typename Key, typename Value, typename Hash>
+std::atomic<typename concurrent_unordered_map<Key, Value, Hash>::Node*>*
+concurrent_unordered_map<Key, Value, Hash>::find_link(Table* table,
+                                                      const Key& key,
+                                                      size_t h) {
+  std::atomic<Node*>* link = &table->buckets[h & table->mask];
+  for (Node* node = link->load(std::memory_order_relaxed);
+       node != nullptr && !(node->hash == h && node->data.first == key);
+       node = link->load(std::memory_order_relaxed)) {
+    link = &node->next;
+  }
+  return link;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool concurrent_unordered_map<Key, Value, Hash>::find(const Key& key,
+                                                      Value& out) const {
+  size_t h = hash(key);
+  EpochDomain::Guard guard(epochs_);
+  Node* node = find_node(
+      segment_of(h).table.load(std::memory_order_acquire), key, h);
+  if (node != nullptr) out = node->data.second;
+  return node != nullptr;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool concurrent_unordered_map<Key, Value, Hash>::contains(
+    const Key& key) const {
+  size_t h = hash(key);
+  EpochDomain::Guard guard(epochs_);
+  return find_node(segment_of(h).table.load(std::memory_order_acquire), key,
+                   h) != nullptr;
+}
+
+template <typename Key, typename Value, typename Hash>
+template <typename Fn>
+void concurrent_unordered_map<Key, Value, Hash>::for_each(Fn fn) const {
+  EpochDomain::Guard guard(epochs_);
+  for (const auto& segment : segments_) {
+    const Table* table = segment.table.load(std::memory_order_acquire);
+    if (table == nullptr) continue;
+    for (const auto& bucket : table->buckets) {
+      for (Node* node = bucket.load(std::memory_order_acquire); node != nullptr;
+           node = node->next.load(std::memory_order_acquire)) {
+        fn(node->data);
+      }
+    }
+  }
+}
+
+template <typename Key, typename Value, typename Hash>
+typename concurrent_unordered_map<Key, Value, Hash>::Table*
+concurrent_unordered_map<Key, Value, Hash>::table_for_insert(
+    Segment& segment) {
+  Table* table = segment.table.load(std::memory_order_relaxed);
+  if (table == nullptr) {
+    table = new Table(kInitialBuckets);
+    segment.table.store(table, std::memory_order_release);
+  } else if (segment.count >= table->buckets.size()) {
+    // readers keep walking the old chains: copy the nodes into a new table
+    // instead of relinking them, then retire the old table with its nodes
+    Table* grown = new Table(table->buckets.size() * 2);
+    for (const auto& bucket : table->buckets) {
+      for (Node* node = bucket.load(std::memory_order_relaxed);
+           node != nullptr; node = node->next.load(std::memory_order_relaxed)) {
+        auto& target = grown->buckets[node->hash & grown->mask];
+        target.store(new Node(node->data.first, node->data.second, node->hash,
+                              target.load(std::memory_order_relaxed)),
+                     std::memory_order_relaxed);
+      }
+    }
+    segment.table.store(grown, std::memory_order_release);
+    retire(segment, nullptr, table);
+    table = grown;
+  }
+  return table;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool concurrent_unordered_map<Key, Value, Hash>::insert(const Key& key,
+                                                        const Value& obj) {
+  size_t h = hash(key);
+  Segment& segment = segment_of(h);
+  std::lock_guard<std::mutex> lock(segment.lock);
+  if (find_node(segment.table.load(std::memory_order_relaxed), key, h)) {
+    return false;
+  }
+  Table* table = table_for_insert(segment);
+  std::atomic<Node*>& bucket = table->buckets[h & table->mask];
+  bucket.store(new Node(key, obj, h, bucket.load(std::memory_order_relaxed)),
+               std::memory_order_release);
+  ++segment.count;
+  count_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+bool concurrent_unordered_map<Key, Value, Hash>::insert_or_assign(
+    const Key& key, const Value& obj) {
+  size_t h = hash(key);
+  Segment& segment = segment_of(h);
+  std::lock_guard<std::mutex> lock(segment.lock);
+  Table* table = segment.table.load(std::memory_order_relaxed);
+  if (table != nullptr) {
+    std::atomic<Node*>* link = find_link(table, key, h);
+    Node* old = link->load(std::memory_order_relaxed);
+    if (old != nullptr) {
+      link->store(
+          new Node(key, obj, h, old->next.load(std::memory_order_relaxed)),
+          std::memory_order_release);
+      retire(segment, old, nullptr);
+      return false;
+    }
+  }
+  table = table_for_insert(segment);
+  std::atomic<Node*>& bucket = table->buckets[h & table->mask];
+  bucket.store(new Node(key, obj, h, bucket.load(std::memory_order_relaxed)),
+               std::memory_order_release);
+  ++segment.count;
+  count_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+template <typename Fn>
+bool concurrent_unordered_map<Key, Value, Hash>::update(const Key& key,
+                                                        Fn fn) {
+  size_t h = hash(key);
+  Segment& segment = segment_of(h);
+  std::lock_guard<std::mutex> lock(segment.lock);
+  Table* table = segment.table.load(std::memory_order_relaxed);
+  if (table == nullptr) return false;
+  std::atomic<Node*>* link = find_link(table, key, h);
+  Node* old = link->load(std::memory_order_relaxed);
+  if (old == nullptr) return false;
+  link->store(new Node(key, fn(old->data.second), h,
+                       old->next.load(std::memory_order_relaxed)),
+              std::memory_order_release);
+  retire(segment, old, nullptr);
+  return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+typename concurrent_unordered_map<Key, Value, Hash>::size_type
+concurrent_unordered_map<Key, Value, Hash>::erase(const Key& key) {
+  size_t h = hash(key);
+  Segment& segment = segment_of(h);
+  std::lock_guard<std::mutex> lock(segment.lock);
+  Table* table = segment.table.load(std::memory_order_relaxed);
+  if (table == nullptr) return 0;
+  std::atomic<Node*>* link = find_link(table, key, h);
+  Node* old = link->load(std::memory_order_relaxed);
+  if (old == nullptr) return 0;
+  // readers standing on old still reach the rest of the chain through it
+  link->store(old->next.load(std::memory_order_relaxed),
+              std::memory_order_release);
+  retire(segment, old, nullptr);
+  --segment.count;
+  count_.fetch_sub(1, std::memory_order_relaxed);
+  return 1;
+}
+
+template <typename Key, typename Value, typename Hash>
+void concurrent_unordered_map<Key, Value, Hash>::clear() {
+  for (auto& segment : segments_) {
+    std::lock_guard<std::mutex> lock(segment.lock);
+    Table* table = segment.table.load(std::memory_order_relaxed);
+    if (table == nullptr) continue;
+    segment.table.store(nullptr, std::memory_order_release);
+    retire(segment, nullptr, table);
+    count_.fetch_sub(segment.count, std::memory_order_relaxed);
+    segment.count = 0;
+  }
+}
+
+template <typename Key, typename Value, typename Hash>
+void concurrent_unordered_map<Key, Value, Hash>::retire(Segment& segment,
+                                                        Node* node,
+                                                        Table* table) {
+  segment.retired.push_back({epochs_.retire_epoch(), node, table});
+  if (segment.retired.size() % kReclaimBatch == 0) reclaim(segment, false);
+}
+
+template <typename Key, typename Value, typename Hash>
+void concurrent_unordered_map<Key, Value, Hash>::reclaim(Segment& segment,
+                                                         bool all) {
+  uint64_t safe = all ? UINT64_MAX : epochs_.safe_epoch();
+  size_type kept = 0;
+  for (const Retired& item : segment.retired) {
+    if (item.epoch < safe) {
+      delete item.node;
+      if (item.table != nullptr) {
+        free_chain(item.table);
+        delete item.table;
+      }
+    } else {
+      segment.retired[kept++] = item;
+    }
+  }
+  segment.retired.resize(kept);
+}
+
+template <typename Key, typename Value, typename Hash>
+void concurrent_unordered_map<Key, Value, Hash>::free_chain(Table* table) {
+  for (auto& bucket : table->buckets) {
+    Node* node = bucket.load(std::memory_order_relaxed);
+    while (node != nullptr) {
+      Node* next = node->next.load(std::memory_order_relaxed);
+      delete node;
+      node = next;
+    }
+  }
+}
+
+}  // namespace s21
+
+#endif  // S21_CONCURRENT_UNORDERED_MAP_H
@@ -0,0 +1,117 @@
+#ifndef S21_EPOCH_H
+#define S21_EPOCH_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace s21 {
+
+// Process-wide small ids of the live threads, reused after a thread exits.
+class ThreadSlots {
+ public:
+  static constexpr size_t kMaxThreads = 256;
+
+  // id of the calling thread, taken on the first call
+  static size_t id() {
+    thread_local Holder holder;
+    return holder.id;
+  }
+
+ private:
+  struct Holder {
+    Holder() : id(acquire()) {}
+    ~Holder() { used()[id].store(false, std::memory_order_release); }
+    size_t id;
+  };
+
+  static std::atomic<bool>* used() {
+    static std::atomic<bool> slots[kMaxThreads] = {};
+    return slots;
+  }
+
+  static size_t acquire() {
+    for (size_t i = 0; i < kMaxThreads; ++i) {
+      bool expected = false;
+      if (!used()[i].load(std::memory_order_relaxed) &&
+          used()[i].compare_exchange_strong(expected, true,
+                                            std::memory_order_acquire)) {
+        return i;
+      }
+    }
+    throw std::runtime_error("too many threads");
+  }
+};
+
+// Epoch-based reclamation. Readers enter a critical section with a Guard,
+// which publishes the epoch they started in. Writers unlink an object, then
+// retire it with the current epoch and bump the epoch, so readers that
+// start afterwards can not reach it. The object is freed once every active
+// reader has started after it was retired.
+//
+// Retired objects are kept by the caller (under its own lock), EpochDomain
+// only tells which of them are safe to free.
+class EpochDomain {
+ public:
+  class Guard {
+   public:
+    explicit Guard(const EpochDomain& domain)
+        : slot_(domain.slots_[ThreadSlots::id()]) {
+      // nested guards keep the epoch of the outermost one
+      if (slot_.depth++ == 0) {
+        slot_.epoch.store(domain.epoch_.load(std::memory_order_seq_cst),
+                          std::memory_order_seq_cst);
+        // the loads inside the section are only acquire; without the fence
+        // they may run before the store is visible to safe_epoch()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+      }
+    }
+    ~Guard() {
+      if (--slot_.depth == 0) {
+        slot_.epoch.store(kIdle, std::memory_order_release);
+      }
+    }
+    Guard(const Guard&) = delete;
+    Guard& operator=(const Guard&) = delete;
+
+   private:
+    friend class EpochDomain;
+    struct alignas(64) Slot {
+      std::atomic<uint64_t> epoch{kIdle};
+      size_t depth = 0;  // touched only by the owning thread
+    };
+    Slot& slot_;
+  };
+
+  EpochDomain() : slots_(ThreadSlots::kMaxThreads) {}
+
+  // epoch to store with an object that has just been unlinked
+  uint64_t retire_epoch() {
+    return epoch_.fetch_add(1, std::memory_order_seq_cst);
+  }
+
+  // objects retired in an epoch below this one are not reachable by anyone
+  uint64_t safe_epoch() const {
+    // pairs with the fence in Guard: either the slot scan sees the reader's
+    // epoch or the reader sees the unlink that preceded this call
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    uint64_t result = epoch_.load(std::memory_order_seq_cst);
+    for (const auto& slot : slots_) {
+      result = std::min(result, slot.epoch.load(std::memory_order_seq_cst));
+    }
+    return result;
+  }
+
+ private:
+  static constexpr uint64_t kIdle = std::numeric_limits<uint64_t>::max();
+
+  std::atomic<uint64_t> epoch_{0};
+  mutable std::vector<Guard::Slot> slots_;
+};
+
+}  // namespace s21
+
+#endif  // S21_EPOCH_H
@@ -0,0 +1,358 @@
+#ifndef S21_EXTERNAL_SORT_H
+#define S21_EXTERNAL_SORT_H
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>  // Для std::pair
+#include <vector>
+
+#include "s21_map.h"
+#include "s21_mapped_set.h"
+#include "s21_set.h"
+
+namespace s21 {
+
+// Buffered sequential reader of a binary file of T records.
+template <typename T>
+class RunReader {
+ public:
+  class Iterator;
+
+  RunReader(const std::string& path, size_t buffer_items)
+      : in_(path, std::ios::binary), buffer_(std::max<size_t>(buffer_items, 1)) {
+    if (!in_) throw std::runtime_error("cannot open run " + path);
+  }
+
+  // reads the next record, false at the end of the file
+  bool next(T& out) {
+    if (pos_ == size_ && !fill()) return false;
+    out = buffer_[pos_++];
+    return true;
+  }
+
+  Iterator begin() { return Iterator(this); }
+
+ private:
+  bool fill() {
+    in_.read(reinterpret_cast<char*>(buffer_.data()),
+             buffer_.size() * sizeof(T));
+    size_ = in_.gcount() / sizeof(T);
+    pos_ = 0;
+    return size_ > 0;
+  }
+
+  std::ifstream in_;
+  std::vector<T> buffer_;
+  size_t pos_ = 0;
+  size_t size_ = 0;
+};
+
+// Single pass input iterator over a RunReader, used to feed build_sorted.
+template <typename T>
+class RunReader<T>::Iterator {
+ public:
+  explicit Iterator(RunReader* reader) : reader_(reader) { ++(*this); }
+  const T& operator*() const { return value_; }
+  Iterator& operator++() {
+    reader_->next(value_);
+    return *this;
+  }
+
+ private:
+  RunReader* reader_;
+  T value_{};
+};
+
+// Temporary files removed together when the guard is destroyed, so that an
+// exception on the way leaves none of them behind.
+class TempFiles {
+ public:
+  TempFiles() = default;
+  TempFiles(const TempFiles&) = delete;
+  TempFiles& operator=(const TempFiles&) = delete;
+  ~TempFiles() { clear(); }
+
+  // takes path over, returns it
+  const std::string& add(std::string path) {
+    paths_.push_back(std::move(path));
+    return paths_.back();
+  }
+  void clear() {
+    for (const auto& path : paths_) std::remove(path.c_str());
+    paths_.clear();
+  }
+  void swap(TempFiles& other) { paths_.swap(other.paths_); }
+  const std::vector<std::string>& paths() const { return paths_; }
+  size_t size() const { return paths_.size(); }
+
+ private:
+  std::vector<std::string> paths_;
+};
+
+// Sorts binary files of trivially copyable records that do not fit in memory.
+// The input is read in chunks of half of memory_budget bytes, every chunk is
+// sorted by several threads and spilled to a temporary run file, then the
+// runs are k-way merged. The sort is stable: equal records (by Compare) keep
+// their input order. With set_unique(true) only the first of them is kept.
+template <typename T, typename Compare = std::less<T>>
+class ExternalSorter {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "external sort records must be trivially copyable");
+
+ public:
+  explicit ExternalSorter(size_t memory_budget,
+                          const std::string& temp_dir = "/tmp",
+                          unsigned threads = 0)
+      : budget_(std::max(memory_budget, kMinRunBuffer * 3)),
+        temp_dir_(temp_dir),
+        threads_(threads ? threads
+                         : std::max(1u, std::thread::hardware_concurrency())) {}
+
+  // sorts input and passes every record to sink in order, returns the count
+  template <typename Sink>
+  size_t sort(const std::string& input, Sink sink);
+
+  // sorts input into the output file, returns the number of records
+  size_t sort(const std::string& input, const std::string& output);
+
+  size_t memory_budget() const { return budget_; }
+  // drop records equal to an earlier one
+  void set_unique(bool unique) { unique_ = unique; }
+  bool unique() const { return unique_; }
+
+  // unique name of a temporary file in temp_dir
+  std::string temp_path();
+
+ protected:
+  // read buffer of a single run during the merge
+  static constexpr size_t kMinRunBuffer = 64 * 1024;
+
+  // sorted runs of the input, added to runs
+  void make_runs(const std::string& input, TempFiles& runs);
+  void sort_chunk(std::vector<T>& chunk);
+  template <typename Sink>
+  size_t merge_runs(const std::vector<std::string>& runs, Sink sink);
+  bool equal(const T& a, const T& b) const {
+    return !compare_(a, b) && !compare_(b, a);
+  }
+
+  size_t budget_;
+  std::string temp_dir_;
+  unsigned threads_;
+  bool unique_ = false;
+  size_t temp_counter_ = 0;
+  Compare compare_;
+};
+
+template <typename T, typename Compare>
+constexpr size_t ExternalSorter<T, Compare>::kMinRunBuffer;
+
+template <typename T, typename Compare>
+std::string ExternalSorter<T, Compare>::temp_path() {
+  return temp_dir_ + "/s21_run_" + std::to_string(getpid()) + "_" +
+         std::to_string(reinterpret_cast<uintptr_t>(this)) + "_" +
+         std::to_string(temp_counter_++) + ".bin";
+}
+
+template <typename T, typename Compare>
+void ExternalSorter<T, Compare>::sort_chunk(std::vector<T>& chunk) {
+  // stable pieces merged pairwise keep the input order of equal records
+  size_t pieces = std::min<size_t>(threads_, chunk.size() / 4096 + 1);
+  size_t step = (chunk.size() + pieces - 1) / pieces;
+  std::vector<std::thread> workers;
+  for (size_t begin = 0; begin < chunk.size(); begin += step) {
+    size_t end = std::min(begin + step, chunk.size());
+    workers.emplace_back([this, &chunk, begin, end] {
+      std::stable_sort(chunk.begin() + begin, chunk.begin() + end, compare_);
+    });
+  }
+  for (auto& worker : workers) worker.join();
+  for (size_t width = step; width < chunk.size(); width *= 2) {
+    for (size_t begin = 0; begin + width < chunk.size(); begin += 2 * width) {
+      size_t end = std::min(begin + 2 * width, chunk.size());
+      std::inplace_merge(chunk.begin() + begin, chunk.begin() + begin + width,
+                         chunk.begin() + end, compare_);
+    }
+  }
+}
+
+template <typename T, typename Compare>
+void ExternalSorter<T, Compare>::make_runs(const std::string& input,
+                                           TempFiles& runs) {
+  std::ifstream in(input, std::ios::binary);
+  if (!in) throw std::runtime_error("cannot open input " + input);
+  // the other half of the budget is the scratch buffer of stable_sort
+  size_t chunk_items = budget_ / 2 / sizeof(T);
+  std::vector<T> chunk(chunk_items);
+  while (in) {
+    in.read(reinterpret_cast<char*>(chunk.data()), chunk.size() * sizeof(T));
+    chunk.resize(in.gcount() / sizeof(T));
+    if (chunk.empty()) break;
+    sort_chunk(chunk);
+    const std::string& run = runs.add(temp_path());
+    std::ofstream out(run, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(chunk.data()),
+              chunk.size() * sizeof(T));
+    if (!out) throw std::runtime_error("cannot write run " + run);
+    chunk.resize(chunk_items);
+  }
+}
+
+template <typename T, typename Compare>
+template <typename Sink>
+size_t ExternalSorter<T, Compare>::merge_runs(
+    const std::vector<std::string>& runs, Sink sink) {
+  size_t buffer_items = budget_ / (runs.size() + 1) / sizeof(T);
+  std::vector<RunReader<T>> readers;
+  readers.reserve(runs.size());
+  for (const auto& run : runs) readers.emplace_back(run, buffer_items);
+
+  // ties are broken by run index, earlier runs hold earlier input
+  using Head = std::pair<T, size_t>;
+  auto later = [this](const Head& a, const Head& b) {
+    return compare_(b.first, a.first) ||
+           (!compare_(a.first, b.first) && a.second > b.second);
+  };
+  std::priority_queue<Head, std::vector<Head>, decltype(later)> heads(later);
+  for (size_t i = 0; i < readers.size(); ++i) {
+    T value;
+    if (readers[i].next(value)) heads.push({value, i});
+  }
+
+  size_t count = 0;
+  T last{};
+  while (!heads.empty()) {
+    Head head = heads.top();
+    heads.pop();
+    if (!unique_ || count == 0 || !equal(last, head.first)) {
+      sink(head.first);
+      last = head.first;
+      ++count;
+    }
+    if (readers[head.second].next(head.first)) heads.push(head);
+  }
+  return count;
+}
+
+template <typename T, typename Compare>
+template <typename Sink>
+size_t ExternalSorter<T, Compare>::sort(const std::string& input, Sink sink) {
+  TempFiles runs;
+  make_runs(input, runs);
+  // every run needs its own read buffer, merge in several passes if the
+  // budget cannot hold all of them at once
+  size_t fan_in = std::max<size_t>(2, budget_ / kMinRunBuffer - 1);
+  while (runs.size() > fan_in) {
+    TempFiles merged;
+    const std::vector<std::string>& paths = runs.paths();
+    for (size_t begin = 0; begin < paths.size(); begin += fan_in) {
+      std::vector<std::string> group(
+          paths.begin() + begin,
+          paths.begin() + std::min(begin + fan_in, paths.size()));
+      const std::string& path = merged.add(temp_path());
+      std::ofstream out(path, std::ios::binary | std::ios::trunc);
+      merge_runs(group, [&out](const T& value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+      });
+      if (!out) throw std::runtime_error("cannot write run " + path);
+      // merged runs are not needed any more, free the disk space now
+      for (const auto& run : group) std::remove(run.c_str());
+    }
+    runs.swap(merged);
+  }
+  return merge_runs(runs.paths(), sink);
+}
+
+template <typename T, typename Compare>
+size_t ExternalSorter<T, Compare>::sort(const std::string& input,
+                                        const std::string& output) {
+  std::ofstream out(output, std::ios::binary | std::ios::trunc);
+  if (!out) throw std::runtime_error("cannot create output " + output);
+  size_t count = sort(input, [&out](const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  });
+  if (!out) throw std::runtime_error("cannot write output " + output);
+  return count;
+}
+
+// Orders MappedPair records by key only.
+template <typename Key, typename Value>
+struct MappedPairKeyLess {
+  bool operator()(const MappedPair<Key, Value>& a,
+                  const MappedPair<Key, Value>& b) const {
+    return b.first > a.first;
+  }
+};
+
+// Loads an unsorted file of keys into a set with the linear-time
+// build_sorted. The set is built from a known count, so the merged stream
+// goes through one more sequential temporary file.
+template <typename Key>
+size_t external_load(const std::string& input, set<Key>& out,
+                     size_t memory_budget,
+                     const std::string& temp_dir = "/tmp") {
+  ExternalSorter<Key> sorter(memory_budget, temp_dir);
+  sorter.set_unique(true);
+  TempFiles temp;
+  const std::string& sorted = temp.add(sorter.temp_path());
+  size_t count = sorter.sort(input, sorted);
+  RunReader<Key> reader(sorted, memory_budget / sizeof(Key));
+  out.build_sorted(reader.begin(), count);
+  return count;
+}
+
+// Loads an unsorted file of MappedPair<Key, Value> records into a map, the
+// first record of every key wins as with map::insert.
+template <typename Key, typename Value>
+size_t external_load(const std::string& input, map<Key, Value>& out,
+                     size_t memory_budget,
+                     const std::string& temp_dir = "/tmp") {
+  using Record = MappedPair<Key, Value>;
+  ExternalSorter<Record, MappedPairKeyLess<Key, Value>> sorter(memory_budget,
+                                                               temp_dir);
+  sorter.set_unique(true);
+  TempFiles temp;
+  const std::string& sorted = temp.add(sorter.temp_path());
+  size_t count = sorter.sort(input, sorted);
+  RunReader<Record> reader(sorted, memory_budget / sizeof(Record));
+  // adapts records to the pairs stored in the map
+  struct PairIterator {
+    typename RunReader<Record>::Iterator it;
+    std::pair<Key, Value> operator*() const {
+      return {(*it).first, (*it).second};
+    }
+    PairIterator& operator++() {
+      ++it;
+      return *this;
+    }
+  } first{reader.begin()};
+  out.build_sorted(first, count);
+  return count;
+}
+
+// Sorts an unsorted file of keys straight into a mapped_set image, one entry
+// per key.
+template <typename Key>
+size_t external_write_image(const std::string& input, const std::string& path,
+                            size_t memory_budget,
+                            const std::string& temp_dir = "/tmp") {
+  ExternalSorter<Key> sorter(memory_budget, temp_dir);
+  sorter.set_unique(true);
+  typename mapped_set<Key>::Writer writer(path);
+  sorter.sort(input, [&writer](const Key& key) { writer.push(key); });
+  return writer.finish();
+}
+
+}  // namespace s21
+
+#endif  // S21_EXTERNAL_SORT_H
@@ -0,0 +1,142 @@
+#ifndef S21_EYTZINGER_H
+#define S21_EYTZINGER_H
+
+#include <cstdint>
+#include <vector>
+
+#include "s21_container.h"
+
+namespace s21 {
+
+// Immutable search index that stores sorted keys in Eytzinger (BFS) order:
+// the children of slot k are 2k and 2k + 1, slot 0 is unused. The top levels
+// of the implicit tree share a few cache lines, the descent is branchless and
+// the grand-children a cache line ahead are prefetched on every step.
+template <typename Key>
+class EytzingerIndex : public Container<Key> {
+ public:
+  using size_type = size_t;
+  class ConstIterator;
+
+  EytzingerIndex() : keys_(1) {}
+
+  // iteration visits the slots in order, i.e. in ascending key order
+  ConstIterator begin() const { return ConstIterator(this, first_slot()); }
+  ConstIterator end() const { return ConstIterator(this, 0); }
+
+  size_type max_size() override { return this->count_; }
+
+ protected:
+  // keys are fetched from the input strictly in ascending order
+  template <typename InputIt, typename Store>
+  void build(InputIt& it, size_type k, Store& store);
+  template <typename InputIt, typename Store>
+  void assign(InputIt first, size_type count, Store store);
+
+  // slot of the first key not less than key, 0 if there is none
+  size_type lower_bound_slot(const Key& key) const;
+  size_type find_slot(const Key& key) const {
+    size_type k = lower_bound_slot(key);
+    return (k != 0 && !(keys_[k] > key)) ? k : 0;
+  }
+
+  size_type first_slot() const {
+    size_type k = 1;
+    while (2 * k <= this->count_) k *= 2;
+    return this->count_ ? k : 0;
+  }
+  size_type next_slot(size_type k) const;
+
+  // keys of one cache line, the slots of 4 levels down for 4-byte keys
+  static constexpr size_type kPrefetchStride =
+      sizeof(Key) >= 64 ? 1 : 64 / sizeof(Key);
+
+  std::vector<Key> keys_;
+};
+
+template <typename Key>
+class EytzingerIndex<Key>::ConstIterator {
+ public:
+  ConstIterator(const EytzingerIndex* index, size_type slot)
+      : index_(index), slot_(slot) {}
+  const Key& operator*() const { return index_->keys_[slot_]; }
+  const Key* operator->() const { return &index_->keys_[slot_]; }
+  ConstIterator& operator++() {
+    slot_ = index_->next_slot(slot_);
+    return *this;
+  }
+  ConstIterator operator++(int) {
+    ConstIterator tmp(*this);
+    ++(*this);
+    return tmp;
+  }
+  bool operator==(const ConstIterator& other) const {
+    return slot_ == other.slot_;
+  }
+  bool operator!=(const ConstIterator& other) const {
+    return slot_ != other.slot_;
+  }
+  size_type slot() const { return slot_; }
+
+ private:
+  const EytzingerIndex* index_;
+  size_type slot_;
+};
+
+template <typename Key>
+constexpr typename EytzingerIndex<Key>::size_type
+    EytzingerIndex<Key>::kPrefetchStride;
+
+template <typename Key>
+template <typename InputIt, typename Store>
+void EytzingerIndex<Key>::build(InputIt& it, size_type k, Store& store) {
+  if (k > this->count_) return;
+  build(it, 2 * k, store);
+  store(k, *it);
+  ++it;
+  build(it, 2 * k + 1, store);
+}
+
+template <typename Key>
+template <typename InputIt, typename Store>
+void EytzingerIndex<Key>::assign(InputIt first, size_type count, Store store) {
+  this->count_ = count;
+  keys_.assign(count + 1, Key{});
+  build(first, 1, store);
+}
+
+template <typename Key>
+typename EytzingerIndex<Key>::size_type EytzingerIndex<Key>::lower_bound_slot(
+    const Key& key) const {
+  const Key* keys = keys_.data();
+  size_type n = this->count_;
+  size_type k = 1;
+  while (k <= n) {
+    // the address is only a hint, computed without forming a pointer past
+    // the end of the array
+    __builtin_prefetch(reinterpret_cast<const void*>(
+        reinterpret_cast<uintptr_t>(keys) + k * kPrefetchStride * sizeof(Key)));
+    k = 2 * k + (key > keys[k]);
+  }
+  // the path turned left for the last time at the answer: drop the trailing
+  // right turns and that left turn
+  k >>= __builtin_ffsll(~static_cast<long long>(k));
+  return k;
+}
+
+template <typename Key>
+typename EytzingerIndex<Key>::size_type EytzingerIndex<Key>::next_slot(
+    size_type k) const {
+  if (2 * k + 1 <= this->count_) {
+    k = 2 * k + 1;
+    while (2 * k <= this->count_) k *= 2;
+  } else {
+    while (k & 1) k >>= 1;
+    k >>= 1;
+  }
+  return k;
+}
+
+}  // namespace s21
+
+#endif  // S21_EYTZINGER_H
@@ -0,0 +1,103 @@
+#ifndef S21_FROZEN_MAP_H
+#define S21_FROZEN_MAP_H
+
+#include <iterator>
+#include <stdexcept>
+#include <utility>  // Для std::pair
+#include <vector>
+
+#include "s21_eytzinger.h"
+#include "s21_map.h"
+
+namespace s21 {
+
+// Immutable map built once from a map or a range of pairs sorted by unique
+// key. Keys are searched in Eytzinger order, values live in a parallel array
+// so the descent only touches keys.
+template <typename Key, typename Value>
+class frozen_map : public EytzingerIndex<Key> {
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<const Key&, const Value&>;
+  using index_type = EytzingerIndex<Key>;
+  class ConstIterator;
+  using iterator = ConstIterator;
+  using const_iterator = ConstIterator;
+
+  frozen_map() : index_type() {}
+  explicit frozen_map(map<Key, Value>& m) { assign(m.begin(), m.size()); }
+  template <typename ForwardIt>
+  frozen_map(ForwardIt first, ForwardIt last) {
+    assign(first, std::distance(first, last));
+  }
+
+  const_iterator begin() const {
+    return ConstIterator(this, this->first_slot());
+  }
+  const_iterator end() const { return ConstIterator(this, 0); }
+
+  const_iterator find(const Key& key) const {
+    return ConstIterator(this, this->find_slot(key));
+  }
+  const_iterator lower_bound(const Key& key) const {
+    return ConstIterator(this, this->lower_bound_slot(key));
+  }
+  bool contains(const Key& key) const { return this->find_slot(key) != 0; }
+
+  // Доступ к элементу по ключу
+  const Value& at(const Key& key) const {
+    size_t k = this->find_slot(key);
+    if (k == 0) {
+      throw std::out_of_range("Key not found");
+    }
+    return values_[k];
+  }
+
+  const Value& operator[](const Key& key) const { return at(key); }
+
+ private:
+  template <typename InputIt>
+  void assign(InputIt first, size_t count) {
+    values_.assign(count + 1, Value{});
+    index_type::assign(first, count,
+                       [this](size_t k, const std::pair<Key, Value>& item) {
+                         this->keys_[k] = item.first;
+                         values_[k] = item.second;
+                       });
+  }
+
+  std::vector<Value> values_;
+};
+
+template <typename Key, typename Value>
+class frozen_map<Key, Value>::ConstIterator {
+ public:
+  ConstIterator(const frozen_map* map, size_t slot) : map_(map), slot_(slot) {}
+  value_type operator*() const {
+    return {map_->keys_[slot_], map_->values_[slot_]};
+  }
+  ConstIterator& operator++() {
+    slot_ = map_->next_slot(slot_);
+    return *this;
+  }
+  ConstIterator operator++(int) {
+    ConstIterator tmp(*this);
+    ++(*this);
+    return tmp;
+  }
+  bool operator==(const ConstIterator& other) const {
+    return slot_ == other.slot_;
+  }
+  bool operator!=(const ConstIterator& other) const {
+    return slot_ != other.slot_;
+  }
+
+ private:
+  const frozen_map* map_;
+  size_t slot_;
+};
+
+}  // namespace s21
+
+#endif  // S21_FROZEN_MAP_H
@@ -0,0 +1,48 @@
+#ifndef S21_FROZEN_SET_H
+#define S21_FROZEN_SET_H
+
+#include <iterator>
+
+#include "s21_eytzinger.h"
+#include "s21_set.h"
+
+namespace s21 {
+
+// Immutable set for read-mostly membership tests, built once from a set or a
+// sorted range of unique keys and searched in Eytzinger order.
+template <typename Key>
+class frozen_set : public EytzingerIndex<Key> {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using index_type = EytzingerIndex<Key>;
+  using iterator = typename index_type::ConstIterator;
+  using const_iterator = typename index_type::ConstIterator;
+
+  frozen_set() : index_type() {}
+  explicit frozen_set(set<Key>& s) { assign(s.begin(), s.size()); }
+  template <typename ForwardIt>
+  frozen_set(ForwardIt first, ForwardIt last) {
+    assign(first, std::distance(first, last));
+  }
+
+  const_iterator find(const Key& key) const {
+    return const_iterator(this, this->find_slot(key));
+  }
+  const_iterator lower_bound(const Key& key) const {
+    return const_iterator(this, this->lower_bound_slot(key));
+  }
+  bool contains(const Key& key) const { return this->find_slot(key) != 0; }
+
+ private:
+  template <typename InputIt>
+  void assign(InputIt first, size_t count) {
+    index_type::assign(first, count, [this](size_t k, const Key& key) {
+      this->keys_[k] = key;
+    });
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_FROZEN_SET_H
@@ -0,0 +1,409 @@
+#ifndef S21_HASH_TABLE_H
+#define S21_HASH_TABLE_H
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <utility>  // Для std::pair
+
+#include "s21_container.h"
+
+namespace s21 {
+
+// Flat open-addressing hash table in the style of Swiss tables. Every slot
+// has a control byte: kEmpty, kDeleted or the low 7 bits of the hash (h2) of
+// the stored element. Slots are grouped by kGroupSize, a lookup compares h2
+// against the control bytes of a whole group at once (SSE2 when available)
+// and touches an element only on a match. Groups are probed quadratically
+// and the probe stops at the first group with an empty slot.
+//
+// KeyOf extracts the key from a stored element, keys are compared with ==.
+template <typename DataType, typename Key, typename KeyOf,
+          typename Hash = std::hash<Key>>
+class HashTable : public Container<DataType> {
+ public:
+  using size_type = std::size_t;
+  class Iterator;
+
+  HashTable() = default;
+  HashTable(std::initializer_list<DataType> const& items);
+  HashTable(const HashTable& other);
+  HashTable(HashTable&& other) { swap(other); }
+  virtual ~HashTable() { release(); }
+
+  HashTable& operator=(const HashTable& other);
+  HashTable& operator=(HashTable&& other);
+
+  Iterator begin() const { return Iterator(this, skip_empty(0)); }
+  Iterator end() const { return Iterator(this, capacity_); }
+
+  void erase(Iterator pos);
+  void clear();
+  void swap(HashTable& other);
+
+  // makes room for count elements without exceeding max_load_factor
+  void reserve(size_type count) {
+    rehash(static_cast<size_type>(std::ceil(count / max_load_factor_)));
+  }
+  // rebuilds the table with at least buckets slots (and enough for size())
+  void rehash(size_type buckets);
+
+  size_type bucket_count() const { return capacity_; }
+  float load_factor() const {
+    return capacity_ ? static_cast<float>(this->count_) / capacity_ : 0.0f;
+  }
+  float max_load_factor() const { return max_load_factor_; }
+  // clamped to [0.125, 0.9375], a table always keeps an empty slot
+  void max_load_factor(float factor) {
+    max_load_factor_ = std::min(std::max(factor, 0.125f), 0.9375f);
+    reset_growth_left();
+  }
+
+ protected:
+  enum InsertMode {
+    INSERT_NO_DUPLICATE = 1,  // Insert without duplicates and without updating
+    INSERT_WITH_UPDATE = 2    // Inserting and updating an existing element
+  };
+  enum : int8_t { kEmpty = -128, kDeleted = -2 };
+  static constexpr size_type kGroupSize = 16;
+
+  std::pair<Iterator, bool> insert_table(const DataType& data, int mode);
+  // slot of the element with the given key, capacity_ if there is none
+  size_type find_slot(const Key& key) const;
+  size_type erase_key(const Key& key);
+
+  size_type hash(const Key& key) const {
+    // std::hash is the identity for integers, spread the bits so that both
+    // h1 (the group) and h2 (the control byte) depend on the whole key
+    uint64_t h = static_cast<uint64_t>(hasher_(key)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_type>(h ^ (h >> 32));
+  }
+  static int8_t h2(size_type hash) { return static_cast<int8_t>(hash & 0x7F); }
+  size_type max_load(size_type capacity) const {
+    return static_cast<size_type>(capacity * max_load_factor_);
+  }
+
+  // bit i is set when control byte i of the group at slot equals value
+  uint32_t match(size_type slot, int8_t value) const;
+  // bit i is set when slot i of the group is empty or deleted
+  uint32_t match_free(size_type slot) const;
+
+  // first full slot at or after slot, capacity_ if there is none
+  size_type skip_empty(size_type slot) const {
+    while (slot < capacity_ && ctrl_[slot] < 0) ++slot;
+    return slot;
+  }
+  // free slot for a new element with the given hash, the table must have room
+  size_type prepare_insert(size_type hash);
+  // makes room for one more element
+  void grow();
+  void resize(size_type capacity);
+  void reset_growth_left() {
+    size_type used = this->count_ + deleted_;
+    growth_left_ = max_load(capacity_) > used ? max_load(capacity_) - used : 0;
+  }
+  void release();
+
+  int8_t* ctrl_ = nullptr;
+  DataType* slots_ = nullptr;
+  size_type capacity_ = 0;     // 0 or a power of two multiple of kGroupSize
+  size_type growth_left_ = 0;  // insertions left before the table grows
+  size_type deleted_ = 0;      // tombstones
+  float max_load_factor_ = 0.875f;
+  Hash hasher_;
+  KeyOf key_of_;
+};
+
+// ---------------------------------- Iterator ---------------------------------
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+class HashTable<DataType, Key, KeyOf, Hash>::Iterator {
+ public:
+  Iterator() = default;
+  Iterator(const HashTable* table, size_type slot)
+      : table_(table), slot_(slot) {}
+
+  DataType& operator*() const { return table_->slots_[slot_]; }
+  DataType* operator->() const { return &table_->slots_[slot_]; }
+  Iterator& operator++() {
+    slot_ = table_->skip_empty(slot_ + 1);
+    return *this;
+  }
+  Iterator operator++(int) {
+    Iterator tmp(*this);
+    ++(*this);
+    return tmp;
+  }
+  bool operator==(const Iterator& other) const { return slot_ == other.slot_; }
+  bool operator!=(const Iterator& other) const { return slot_ != other.slot_; }
+
+ protected:
+  friend class HashTable;
+
+  const HashTable* table_ = nullptr;
+  size_type slot_ = 0;
+};
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+constexpr typename HashTable<DataType, Key, KeyOf, Hash>::size_type
+    HashTable<DataType, Key, KeyOf, Hash>::kGroupSize;
+
+// -------------------- constructors and destructors ------------------------
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+HashTable<DataType, Key, KeyOf, Hash>::HashTable(
+    std::initializer_list<DataType> const& items) {
+  reserve(items.size());
+  for (const auto& item : items) insert_table(item, INSERT_NO_DUPLICATE);
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+HashTable<DataType, Key, KeyOf, Hash>::HashTable(const HashTable& other)
+    : max_load_factor_(other.max_load_factor_) {
+  reserve(other.count_);
+  for (const auto& item : other) insert_table(item, INSERT_NO_DUPLICATE);
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+HashTable<DataType, Key, KeyOf, Hash>&
+HashTable<DataType, Key, KeyOf, Hash>::operator=(const HashTable& other) {
+  if (this != &other) {
+    HashTable copy(other);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+HashTable<DataType, Key, KeyOf, Hash>&
+HashTable<DataType, Key, KeyOf, Hash>::operator=(HashTable&& other) {
+  if (this != &other) {
+    release();
+    this->count_ = 0;
+    capacity_ = growth_left_ = deleted_ = 0;
+    swap(other);
+  }
+  return *this;
+}
+
+// ----------------------------  methods  ------------------------------
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+uint32_t HashTable<DataType, Key, KeyOf, Hash>::match(size_type slot,
+                                                     int8_t value) const {
+#if defined(__SSE2__)
+  __m128i group =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(ctrl_ + slot));
+  return static_cast<uint32_t>(
+      _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(value))));
+#else
+  uint32_t mask = 0;
+  for (size_type i = 0; i < kGroupSize; ++i) {
+    mask |= static_cast<uint32_t>(ctrl_[slot + i] == value) << i;
+  }
+  return mask;
+#endif
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+uint32_t HashTable<DataType, Key, KeyOf, Hash>::match_free(
+    size_type slot) const {
+#if defined(__SSE2__)
+  // kEmpty and kDeleted are the only control bytes with the sign bit set
+  __m128i group =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(ctrl_ + slot));
+  return static_cast<uint32_t>(_mm_movemask_epi8(group));
+#else
+  uint32_t mask = 0;
+  for (size_type i = 0; i < kGroupSize; ++i) {
+    mask |= static_cast<uint32_t>(ctrl_[slot + i] < 0) << i;
+  }
+  return mask;
+#endif
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+typename HashTable<DataType, Key, KeyOf, Hash>::size_type
+HashTable<DataType, Key, KeyOf, Hash>::find_slot(const Key& key) const {
+  if (capacity_ == 0) return capacity_;
+  size_type h = hash(key);
+  size_type mask = capacity_ / kGroupSize - 1;
+  size_type group = (h >> 7) & mask;
+  // triangular steps visit every group of a power of two table
+  for (size_type step = 1; step <= mask + 1; ++step) {
+    size_type base = group * kGroupSize;
+    for (uint32_t bits = match(base, h2(h)); bits != 0; bits &= bits - 1) {
+      size_type slot = base + __builtin_ctz(bits);
+      if (key_of_(slots_[slot]) == key) return slot;
+    }
+    if (match(base, kEmpty) != 0) break;
+    group = (group + step) & mask;
+  }
+  return capacity_;
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+typename HashTable<DataType, Key, KeyOf, Hash>::size_type
+HashTable<DataType, Key, KeyOf, Hash>::prepare_insert(size_type h) {
+  size_type mask = capacity_ / kGroupSize - 1;
+  size_type group = (h >> 7) & mask;
+  for (size_type step = 1;; ++step) {
+    size_type base = group * kGroupSize;
+    uint32_t bits = match_free(base);
+    if (bits != 0) {
+      size_type slot = base + __builtin_ctz(bits);
+      if (ctrl_[slot] == kDeleted) {
+        --deleted_;
+      } else {
+        --growth_left_;
+      }
+      ctrl_[slot] = h2(h);
+      return slot;
+    }
+    group = (group + step) & mask;
+  }
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+std::pair<typename HashTable<DataType, Key, KeyOf, Hash>::Iterator, bool>
+HashTable<DataType, Key, KeyOf, Hash>::insert_table(const DataType& data,
+                                                    int mode) {
+  size_type slot = find_slot(key_of_(data));
+  if (slot != capacity_) {
+    if (mode == INSERT_WITH_UPDATE) slots_[slot] = data;
+    return {Iterator(this, slot), false};
+  }
+  if (growth_left_ == 0) grow();
+  slot = prepare_insert(hash(key_of_(data)));
+  new (slots_ + slot) DataType(data);
+  ++this->count_;
+  return {Iterator(this, slot), true};
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+void HashTable<DataType, Key, KeyOf, Hash>::grow() {
+  size_type capacity = capacity_ ? capacity_ : kGroupSize;
+  // many tombstones: rebuild in place instead of doubling
+  if (capacity_ != 0 && deleted_ <= this->count_ / 2) capacity *= 2;
+  while (max_load(capacity) <= this->count_) capacity *= 2;
+  resize(capacity);
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+void HashTable<DataType, Key, KeyOf, Hash>::erase(Iterator pos) {
+  if (pos == end()) return;
+  size_type slot = pos.slot_;
+  slots_[slot].~DataType();
+  // a probe that reached this group stops here if it has an empty slot, so
+  // the slot can become empty again instead of a tombstone
+  size_type base = slot & ~(kGroupSize - 1);
+  if (match(base, kEmpty) != 0) {
+    ctrl_[slot] = kEmpty;
+    ++growth_left_;
+  } else {
+    ctrl_[slot] = kDeleted;
+    ++deleted_;
+  }
+  --this->count_;
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+typename HashTable<DataType, Key, KeyOf, Hash>::size_type
+HashTable<DataType, Key, KeyOf, Hash>::erase_key(const Key& key) {
+  size_type slot = find_slot(key);
+  if (slot == capacity_) return 0;
+  erase(Iterator(this, slot));
+  return 1;
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+void HashTable<DataType, Key, KeyOf, Hash>::rehash(size_type buckets) {
+  size_type needed = std::max(buckets, static_cast<size_type>(std::ceil(
+                                           this->count_ / max_load_factor_)));
+  size_type capacity = kGroupSize;
+  while (capacity < needed) capacity *= 2;
+  if (needed == 0 && this->count_ == 0) {
+    release();
+    capacity_ = growth_left_ = deleted_ = 0;
+  } else if (capacity != capacity_ || deleted_ != 0) {
+    resize(capacity);
+  }
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+void HashTable<DataType, Key, KeyOf, Hash>::resize(size_type capacity) {
+  int8_t* old_ctrl = ctrl_;
+  DataType* old_slots = slots_;
+  size_type old_capacity = capacity_;
+
+  ctrl_ = static_cast<int8_t*>(::operator new(
+      capacity, std::align_val_t(kGroupSize)));
+  std::memset(ctrl_, static_cast<unsigned char>(kEmpty), capacity);
+  slots_ = static_cast<DataType*>(::operator new(
+      capacity * sizeof(DataType), std::align_val_t(alignof(DataType))));
+  capacity_ = capacity;
+  deleted_ = 0;
+  // count_ already includes the moved elements
+  growth_left_ = capacity;
+
+  for (size_type slot = 0; slot < old_capacity; ++slot) {
+    if (old_ctrl[slot] >= 0) {
+      size_type target = prepare_insert(hash(key_of_(old_slots[slot])));
+      new (slots_ + target) DataType(std::move(old_slots[slot]));
+      old_slots[slot].~DataType();
+    }
+  }
+  reset_growth_left();
+  if (old_ctrl != nullptr) {
+    ::operator delete(old_ctrl, std::align_val_t(kGroupSize));
+    ::operator delete(old_slots, std::align_val_t(alignof(DataType)));
+  }
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+void HashTable<DataType, Key, KeyOf, Hash>::release() {
+  if (ctrl_ == nullptr) return;
+  for (size_type slot = 0; slot < capacity_; ++slot) {
+    if (ctrl_[slot] >= 0) slots_[slot].~DataType();
+  }
+  ::operator delete(ctrl_, std::align_val_t(kGroupSize));
+  ::operator delete(slots_, std::align_val_t(alignof(DataType)));
+  ctrl_ = nullptr;
+  slots_ = nullptr;
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+void HashTable<DataType, Key, KeyOf, Hash>::clear() {
+  // keeps the buckets, like std::unordered_map::clear
+  for (size_type slot = 0; slot < capacity_; ++slot) {
+    if (ctrl_[slot] >= 0) slots_[slot].~DataType();
+  }
+  if (capacity_ != 0) {
+    std::memset(ctrl_, static_cast<unsigned char>(kEmpty), capacity_);
+  }
+  this->count_ = 0;
+  deleted_ = 0;
+  reset_growth_left();
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+void HashTable<DataType, Key, KeyOf, Hash>::swap(HashTable& other) {
+  std::swap(ctrl_, other.ctrl_);
+  std::swap(slots_, other.slots_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(growth_left_, other.growth_left_);
+  std::swap(deleted_, other.deleted_);
+  std::swap(max_load_factor_, other.max_load_factor_);
+  std::swap(this->count_, other.count_);
+  std::swap(hasher_, other.hasher_);
+}
+
+}  // namespace s21
+
+#endif  // S21_HASH_TABLE_H
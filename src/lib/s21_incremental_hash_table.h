@@ -0,0 +1,311 @@
+#ifndef S21_INCREMENTAL_HASH_TABLE_H
+#define S21_INCREMENTAL_HASH_TABLE_H
+
+#include <utility>  // Для std::pair
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+
+// HashTable that grows without a stop-the-world rehash. When the current
+// table runs out of room it becomes the old table and an empty one of twice
+// the size takes its place; every following insert, lookup and erase by key
+// moves the elements of a few slots of the old table, until it is
+// empty and released. Meanwhile lookups check both tables and insertions go
+// to the new one only.
+//
+// The number of slots moved per operation is chosen when the migration
+// starts, so that it finishes before insertions can fill the new table: one
+// group (16 slots) with the default max_load_factor. Starting a migration
+// still clears the control bytes of the new table (one byte per slot),
+// which is much cheaper than moving the elements.
+template <typename DataType, typename Key, typename KeyOf,
+          typename Hash = std::hash<Key>>
+class IncrementalHashTable : public Container<DataType> {
+ public:
+  using size_type = std::size_t;
+  class Iterator;
+
+  IncrementalHashTable() = default;
+  IncrementalHashTable(std::initializer_list<DataType> const& items) {
+    for (const auto& item : items) {
+      insert_table(item, INSERT_NO_DUPLICATE);
+    }
+  }
+  IncrementalHashTable(const IncrementalHashTable& other);
+  IncrementalHashTable(IncrementalHashTable&& other) { swap(other); }
+
+  IncrementalHashTable& operator=(const IncrementalHashTable& other);
+  IncrementalHashTable& operator=(IncrementalHashTable&& other);
+
+  // the old table is visited first
+  Iterator begin() const;
+  Iterator end() const { return Iterator(&current_, current_.capacity_); }
+
+  // does not move any elements, so other iterators stay valid
+  void erase(Iterator pos);
+  void clear();
+  void swap(IncrementalHashTable& other);
+
+  // finishes a pending migration and makes room for count elements
+  void reserve(size_type count) {
+    finish_migration();
+    current_.reserve(count);
+  }
+
+  size_type bucket_count() const {
+    return current_.capacity_ + old_.capacity_;
+  }
+  float load_factor() const {
+    return current_.capacity_
+               ? static_cast<float>(this->count_) / current_.capacity_
+               : 0.0f;
+  }
+  float max_load_factor() const { return current_.max_load_factor(); }
+  // the old table is drained first: the room left for it in the new one was
+  // counted with the previous factor
+  void max_load_factor(float factor) {
+    finish_migration();
+    current_.max_load_factor(factor);
+  }
+  bool is_migrating() const { return old_.capacity_ != 0; }
+
+ protected:
+  enum InsertMode {
+    INSERT_NO_DUPLICATE = 1,  // Insert without duplicates and without updating
+    INSERT_WITH_UPDATE = 2    // Inserting and updating an existing element
+  };
+
+  using Table = HashTable<DataType, Key, KeyOf, Hash>;
+  // gives this class access to the internals of the two tables
+  struct Part : Table {
+    friend class IncrementalHashTable;
+  };
+
+  std::pair<Iterator, bool> insert_table(const DataType& data, int mode);
+  // moves one more portion of the old table, if any
+  Iterator find_key(const Key& key);
+  size_type erase_key(const Key& key);
+
+  void migrate_step();
+  void finish_migration() {
+    while (is_migrating()) migrate_step();
+  }
+  void start_migration();
+
+  Part current_;
+  Part old_;
+  size_type cursor_ = 0;  // next slot of old_ to move
+  size_type pace_ = 0;    // slots of old_ moved per operation
+  KeyOf key_of_;
+};
+
+// ---------------------------------- Iterator ---------------------------------
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+class IncrementalHashTable<DataType, Key, KeyOf, Hash>::Iterator {
+ public:
+  Iterator() = default;
+  Iterator(const Part* part, size_type slot) : part_(part), slot_(slot) {}
+
+  DataType& operator*() const { return part_->slots_[slot_]; }
+  DataType* operator->() const { return &part_->slots_[slot_]; }
+  Iterator& operator++() {
+    slot_ = part_->skip_empty(slot_ + 1);
+    if (slot_ == part_->capacity_ && next_ != nullptr) {
+      part_ = next_;
+      next_ = nullptr;
+      slot_ = part_->skip_empty(0);
+    }
+    return *this;
+  }
+  Iterator operator++(int) {
+    Iterator tmp(*this);
+    ++(*this);
+    return tmp;
+  }
+  bool operator==(const Iterator& other) const {
+    return part_ == other.part_ && slot_ == other.slot_;
+  }
+  bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+ protected:
+  friend class IncrementalHashTable;
+
+  const Part* part_ = nullptr;
+  // the table visited after part_, set while iterating the old table
+  const Part* next_ = nullptr;
+  size_type slot_ = 0;
+};
+
+// -------------------- constructors and destructors ------------------------
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+IncrementalHashTable<DataType, Key, KeyOf, Hash>::IncrementalHashTable(
+    const IncrementalHashTable& other) {
+  max_load_factor(other.max_load_factor());
+  reserve(other.count_);
+  for (const auto& item : other) insert_table(item, INSERT_NO_DUPLICATE);
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+IncrementalHashTable<DataType, Key, KeyOf, Hash>&
+IncrementalHashTable<DataType, Key, KeyOf, Hash>::operator=(
+    const IncrementalHashTable& other) {
+  if (this != &other) {
+    IncrementalHashTable copy(other);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+IncrementalHashTable<DataType, Key, KeyOf, Hash>&
+IncrementalHashTable<DataType, Key, KeyOf, Hash>::operator=(
+    IncrementalHashTable&& other) {
+  if (this != &other) {
+    IncrementalHashTable empty;
+    swap(empty);
+    swap(other);
+  }
+  return *this;
+}
+
+// ----------------------------  methods  ------------------------------
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+typename IncrementalHashTable<DataType, Key, KeyOf, Hash>::Iterator
+IncrementalHashTable<DataType, Key, KeyOf, Hash>::begin() const {
+  Iterator it(&current_, current_.skip_empty(0));
+  if (is_migrating()) {
+    size_type slot = old_.skip_empty(0);
+    if (slot != old_.capacity_) {
+      it = Iterator(&old_, slot);
+      it.next_ = &current_;
+    }
+  }
+  return it;
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+void IncrementalHashTable<DataType, Key, KeyOf, Hash>::start_migration() {
+  size_type capacity = current_.capacity_;
+  if (capacity == 0) {
+    current_.resize(Part::kGroupSize);
+    return;
+  }
+  // many tombstones: move to a table of the same size instead of doubling
+  if (current_.deleted_ <= current_.count_ / 2) capacity *= 2;
+  // after a lower max_load_factor one doubling may not be enough
+  while (current_.max_load(capacity) <= current_.count_) capacity *= 2;
+  old_.swap(current_);
+  current_.max_load_factor(old_.max_load_factor());
+  current_.resize(capacity);
+  cursor_ = 0;
+  // every insertion takes one slot of the room left after moving old_, the
+  // old table must be drained within half of those insertions
+  size_type room = current_.growth_left_ > old_.count_
+                       ? current_.growth_left_ - old_.count_
+                       : 1;
+  size_type slots = (2 * old_.capacity_ + room - 1) / room;
+  pace_ = std::max<size_type>(
+      Part::kGroupSize,
+      (slots + Part::kGroupSize - 1) / Part::kGroupSize * Part::kGroupSize);
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+void IncrementalHashTable<DataType, Key, KeyOf, Hash>::migrate_step() {
+  if (!is_migrating()) return;
+  size_type stop = std::min(old_.capacity_, cursor_ + pace_);
+  for (; cursor_ < stop; ++cursor_) {
+    if (old_.ctrl_[cursor_] < 0) continue;
+    DataType& item = old_.slots_[cursor_];
+    size_type slot = current_.prepare_insert(current_.hash(key_of_(item)));
+    new (current_.slots_ + slot) DataType(std::move(item));
+    ++current_.count_;
+    item.~DataType();
+    old_.ctrl_[cursor_] = Part::kDeleted;
+    --old_.count_;
+  }
+  if (cursor_ == old_.capacity_) {
+    old_.rehash(0);  // old_ is empty, releases its memory
+    cursor_ = 0;
+  }
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+std::pair<typename IncrementalHashTable<DataType, Key, KeyOf, Hash>::Iterator,
+          bool>
+IncrementalHashTable<DataType, Key, KeyOf, Hash>::insert_table(
+    const DataType& data, int mode) {
+  Iterator it = find_key(key_of_(data));
+  if (it != end()) {
+    if (mode == INSERT_WITH_UPDATE) *it = data;
+    return {it, false};
+  }
+  if (current_.growth_left_ == 0) {
+    // cannot happen while migrating (see above), but stay correct anyway
+    finish_migration();
+    start_migration();
+  }
+  size_type slot = current_.prepare_insert(current_.hash(key_of_(data)));
+  new (current_.slots_ + slot) DataType(data);
+  ++current_.count_;
+  ++this->count_;
+  return {Iterator(&current_, slot), true};
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+typename IncrementalHashTable<DataType, Key, KeyOf, Hash>::Iterator
+IncrementalHashTable<DataType, Key, KeyOf, Hash>::find_key(const Key& key) {
+  migrate_step();
+  size_type slot = current_.find_slot(key);
+  if (slot != current_.capacity_) return Iterator(&current_, slot);
+  if (is_migrating()) {
+    slot = old_.find_slot(key);
+    if (slot != old_.capacity_) {
+      Iterator it(&old_, slot);
+      it.next_ = &current_;
+      return it;
+    }
+  }
+  return end();
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+void IncrementalHashTable<DataType, Key, KeyOf, Hash>::erase(Iterator pos) {
+  if (pos == end()) return;
+  Part* part = pos.part_ == &old_ ? &old_ : &current_;
+  part->erase(typename Table::Iterator(part, pos.slot_));
+  --this->count_;
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+typename IncrementalHashTable<DataType, Key, KeyOf, Hash>::size_type
+IncrementalHashTable<DataType, Key, KeyOf, Hash>::erase_key(const Key& key) {
+  Iterator it = find_key(key);
+  if (it == end()) return 0;
+  erase(it);
+  return 1;
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+void IncrementalHashTable<DataType, Key, KeyOf, Hash>::clear() {
+  old_.clear();
+  old_.rehash(0);
+  cursor_ = 0;
+  current_.clear();
+  this->count_ = 0;
+}
+
+template <typename DataType, typename Key, typename KeyOf, typename Hash>
+void IncrementalHashTable<DataType, Key, KeyOf, Hash>::swap(
+    IncrementalHashTable& other) {
+  current_.swap(other.current_);
+  old_.swap(other.old_);
+  std::swap(cursor_, other.cursor_);
+  std::swap(pace_, other.pace_);
+  std::swap(this->count_, other.count_);
+}
+
+}  // namespace s21
+
+#endif  // S21_INCREMENTAL_HASH_TABLE_H
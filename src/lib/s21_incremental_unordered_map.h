@@ -0,0 +1,82 @@
+#ifndef S21_INCREMENTAL_UNORDERED_MAP_H
+#define S21_INCREMENTAL_UNORDERED_MAP_H
+
+#include <functional>
+#include <utility>  // Для std::pair
+#include <vector>
+
+#include "s21_incremental_hash_table.h"
+#include "s21_unordered_map.h"
+
+namespace s21 {
+
+// unordered_map with bounded per-operation latency: the table grows
+// incrementally, see IncrementalHashTable. Besides growing inserts, every
+// lookup may move elements, so insert, find, at, operator[], contains and
+// erase by key invalidate iterators while is_migrating().
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class incremental_unordered_map
+    : public IncrementalHashTable<std::pair<Key, Value>, Key,
+                                  PairKeyOf<Key, Value>, Hash> {
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<const Key, Value>;
+  using table_type = IncrementalHashTable<std::pair<Key, Value>, Key,
+                                          PairKeyOf<Key, Value>, Hash>;
+  using iterator = typename table_type::Iterator;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = typename table_type::size_type;
+
+  using table_type::table_type;
+  using table_type::erase;
+
+  std::pair<iterator, bool> insert(const std::pair<const Key, Value>& value) {
+    return this->insert_table(value, table_type::INSERT_NO_DUPLICATE);
+  }
+
+  std::pair<iterator, bool> insert(const Key& key, const Value& obj) {
+    return this->insert_table(std::make_pair(key, obj),
+                              table_type::INSERT_NO_DUPLICATE);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const Value& obj) {
+    return this->insert_table(std::make_pair(key, obj),
+                              table_type::INSERT_WITH_UPDATE);
+  }
+
+  iterator find(const Key& key) { return this->find_key(key); }
+
+  // Доступ к элементу по ключу
+  Value& at(const Key& key) {
+    iterator it = find(key);
+    if (it == this->end()) {
+      throw std::out_of_range("Key not found");
+    }
+    return (*it).second;
+  }
+
+  // Доступ или вставка элемента по заданному ключу
+  Value& operator[](const Key& key) {
+    return (*this->insert_table(std::make_pair(key, Value{}),
+                                table_type::INSERT_NO_DUPLICATE)
+                 .first)
+        .second;
+  }
+
+  bool contains(const Key& key) { return find(key) != this->end(); }
+
+  size_type erase(const Key& key) { return this->erase_key(key); }
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    std::vector<std::pair<iterator, bool>> results;
+    (void)(results.push_back(this->insert(std::forward<Args>(args))), ...);
+    return results;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_INCREMENTAL_UNORDERED_MAP_H
@@ -0,0 +1,134 @@
+#ifndef S21_INTERVAL_MAP_H
+#define S21_INTERVAL_MAP_H
+
+#include <stdexcept>
+#include <utility>  // Для std::pair
+#include <vector>
+
+#include "s21_monoid.h"
+#include "s21_tree.h"
+
+namespace s21 {
+
+// Largest end among the intervals of a subtree
+template <typename Key>
+struct IntervalEndMax : Max<Key> {
+  template <typename Item>
+  Key operator()(const Item& item) const {
+    return item.first.second;
+  }
+};
+
+// Closed intervals [lo, hi] with a value each, ordered by (lo, hi); equal
+// intervals are allowed. The Tree is augmented with the largest end of every
+// subtree, so a query skips the subtrees that end before it and stops at the
+// first interval that starts after it: O(log n + k) for k results on typical
+// data, O(k log n) at worst. The tree uses SCAPEGOAT balancing, so
+// intervals inserted in order of their start keep it shallow.
+//
+// Key must be an arithmetic type (the monoid identity is its lowest value).
+template <typename Key, typename Value>
+class interval_map
+    : public Tree<std::pair<std::pair<Key, Key>, Value>, IntervalEndMax<Key>> {
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using interval_type = std::pair<Key, Key>;
+  using value_type = std::pair<interval_type, Value>;
+  using tree_type = Tree<value_type, IntervalEndMax<Key>>;
+  using NodeType = typename tree_type::Node;
+  using iterator = typename tree_type::Iterator;
+  using const_iterator = typename tree_type::ConstIterator;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+
+  interval_map() : tree_type(tree_type::SCAPEGOAT) {}
+  interval_map(std::initializer_list<value_type> const& items)
+      : interval_map() {
+    for (const auto& item : items) insert(item);
+  }
+
+  iterator insert(const value_type& item) {
+    if (item.first.second < item.first.first) {
+      throw std::invalid_argument("Interval ends before it starts");
+    }
+    return this->insert_tree(item, tree_type::INSERT_DUPLICATES).first;
+  }
+  iterator insert(const Key& lo, const Key& hi, const Value& value) {
+    return insert(value_type(interval_type(lo, hi), value));
+  }
+
+  // first interval equal to [lo, hi], end() if there is none
+  iterator find(const Key& lo, const Key& hi) {
+    return this->find_tree(value_type(interval_type(lo, hi), Value{}));
+  }
+
+  // calls visit(item) for every interval that overlaps [lo, hi], in order
+  template <typename Visit>
+  void for_each_overlapping(const Key& lo, const Key& hi, Visit visit) {
+    auto visit_node = [&visit](NodeType* node) {
+      visit(node->data);
+      return true;
+    };
+    visit_overlapping(this->root_, lo, hi, visit_node);
+  }
+
+  std::vector<iterator> overlapping(const Key& lo, const Key& hi) {
+    std::vector<iterator> result;
+    auto collect = [this, &result](NodeType* node) {
+      result.push_back(iterator(node, *this));
+      return true;
+    };
+    visit_overlapping(this->root_, lo, hi, collect);
+    return result;
+  }
+
+  // intervals that contain point
+  std::vector<iterator> stabbing(const Key& point) {
+    return overlapping(point, point);
+  }
+
+  // stops at the first overlapping interval, one walk down the tree
+  bool overlaps(const Key& lo, const Key& hi) {
+    auto stop = [](NodeType*) { return false; };
+    return !visit_overlapping(this->root_, lo, hi, stop);
+  }
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    std::vector<std::pair<iterator, bool>> results;
+    (void)(results.push_back(
+               std::make_pair(insert(std::forward<Args>(args)), true)),
+           ...);
+    return results;
+  }
+
+ protected:
+  // visit(node) returns false to stop the walk, the result is false then
+  template <typename Visit>
+  bool visit_overlapping(NodeType* node, const Key& lo, const Key& hi,
+                         Visit& visit);
+
+  bool const_comparator(const value_type& data1,
+                        const value_type& data2) const override {
+    return data1.first > data2.first;
+  }
+};
+
+template <typename Key, typename Value>
+template <typename Visit>
+bool interval_map<Key, Value>::visit_overlapping(NodeType* node, const Key& lo,
+                                                 const Key& hi, Visit& visit) {
+  // the left subtrees are visited recursively, the right spine in a loop
+  while (node != nullptr && !(node->aggregate < lo)) {
+    if (!visit_overlapping(node->left, lo, hi, visit)) return false;
+    if (hi < node->data.first.first) return true;  // the rest starts after hi
+    if (!(node->data.first.second < lo) && !visit(node)) return false;
+    node = node->right;
+  }
+  return true;
+}
+
+}  // namespace s21
+
+#endif  // S21_INTERVAL_MAP_H
@@ -0,0 +1,454 @@
+#ifndef S21_INTRUSIVE_LIST_H
+#define S21_INTRUSIVE_LIST_H
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_container.h"
+
+namespace s21 {
+
+// Links embedded in an element of an s21::intrusive_list. A copy of an
+// element starts unlinked: the links belong to the object, not to its value.
+template <typename T>
+struct intrusive_list_hook {
+  intrusive_list_hook() = default;
+  intrusive_list_hook(const intrusive_list_hook&) {}
+  intrusive_list_hook& operator=(const intrusive_list_hook&) { return *this; }
+
+  T* pNext_ = nullptr;
+  T* pPrev_ = nullptr;
+};
+
+// Doubly linked list of objects owned elsewhere (pools, arrays, members),
+// linked through the hook member Hook of the element:
+//
+//   struct Timer {
+//     s21::intrusive_list_hook<Timer> hook;
+//   };
+//   s21::intrusive_list<Timer, &Timer::hook> timers;
+//
+// Same interface as s21::list, but insert and push take the element by
+// reference and link the object itself: nothing is allocated, copied or
+// destroyed. An element may be in one list per hook at a time, must outlive
+// its membership and must not move while linked. Erasing, popping or
+// clearing only unlinks. insert, erase and all splices are O(1), except a
+// range splice between two lists without the count.
+template <typename T, intrusive_list_hook<T> T::*Hook>
+class intrusive_list : public Container<T> {
+ public:
+  template <bool Const>
+  class Iterator;
+
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+  using size_type = std::size_t;
+
+  intrusive_list() = default;
+  // an element cannot be in two lists through one hook
+  intrusive_list(const intrusive_list&) = delete;
+  intrusive_list& operator=(const intrusive_list&) = delete;
+  intrusive_list(intrusive_list&& other) noexcept { swap(other); }
+  intrusive_list& operator=(intrusive_list&& other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+  ~intrusive_list() { clear(); }
+
+  // unlinks all elements
+  void clear();
+  // links value before pos, returns the iterator to it
+  iterator insert(const_iterator pos, reference value);
+  // unlinks the element at pos, returns the iterator following it
+  iterator erase(const_iterator pos);
+  // unlinks [first, last), returns last
+  iterator erase(const_iterator first, const_iterator last);
+  void push_back(reference value) { insert(end(), value); }
+  void push_front(reference value) { insert(begin(), value); }
+  void pop_back();
+  void pop_front();
+  // moves all elements of other before pos
+  void splice(const_iterator pos, intrusive_list& other);
+  // moves the element at it from other (which may be *this) before pos
+  void splice(const_iterator pos, intrusive_list& other, const_iterator it);
+  // moves [first, last) from other before pos, counting the range when other
+  // is another list
+  void splice(const_iterator pos, intrusive_list& other, const_iterator first,
+              const_iterator last);
+  // the same with count = distance(first, last) given by the caller
+  void splice(const_iterator pos, intrusive_list& other, const_iterator first,
+              const_iterator last, size_type count);
+  void reverse();
+  // merges two sorted lists by relinking, stable; other is left empty
+  void merge(intrusive_list& other) { merge(other, std::less<value_type>()); }
+  template <typename Compare>
+  void merge(intrusive_list& other, Compare comp);
+  // stable bottom-up merge sort over the links
+  void sort() { sort(std::less<value_type>()); }
+  template <typename Compare>
+  void sort(Compare comp);
+  // unlinks the elements with pred(element), returns their number
+  template <typename Predicate>
+  size_type remove_if(Predicate pred);
+  void swap(intrusive_list& other) noexcept {
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    std::swap(this->count_, other.count_);
+  }
+
+  reference front() {
+    if (head_ == nullptr) throw std::out_of_range("List is empty");
+    return *head_;
+  }
+  const_reference front() const {
+    if (head_ == nullptr) throw std::out_of_range("List is empty");
+    return *head_;
+  }
+  reference back() {
+    if (tail_ == nullptr) throw std::out_of_range("List is empty");
+    return *tail_;
+  }
+  const_reference back() const {
+    if (tail_ == nullptr) throw std::out_of_range("List is empty");
+    return *tail_;
+  }
+
+  iterator begin() { return iterator(head_, this); }
+  iterator end() { return iterator(nullptr, this); }
+  const_iterator begin() const { return const_iterator(head_, this); }
+  const_iterator end() const { return const_iterator(nullptr, this); }
+  // iterator to an element linked into this list, O(1)
+  iterator iterator_to(reference value) { return iterator(&value, this); }
+  const_iterator iterator_to(const_reference value) const {
+    return const_iterator(&value, this);
+  }
+
+ protected:
+  static intrusive_list_hook<T>& hook(T* item) { return item->*Hook; }
+
+  // unlinks the chain first..last (inclusive) of count elements from other
+  // and links it before pos (nullptr for the end)
+  void transfer(T* pos, intrusive_list& other, T* first, T* last,
+                size_type count);
+  // merges two sorted chains linked by pNext_ only, equal elements of first
+  // go first; returns the head of the merged chain
+  template <typename Compare>
+  static T* merge_chains(T* first, T* second, Compare& comp);
+  // head_ is the start of a chain linked by pNext_ only: restores pPrev_ and
+  // tail_
+  void relink_prev();
+
+  T* head_ = nullptr;
+  T* tail_ = nullptr;
+};
+
+template <typename T, intrusive_list_hook<T> T::*Hook>
+template <bool Const>
+class intrusive_list<T, Hook>::Iterator {
+ public:
+  using list_type =
+      std::conditional_t<Const, const intrusive_list, intrusive_list>;
+  using reference = std::conditional_t<Const, const T&, T&>;
+  using pointer = std::conditional_t<Const, const T*, T*>;
+
+  Iterator(pointer item = nullptr, list_type* list = nullptr)
+      : current_(item), list_(list) {}
+  // iterator -> const_iterator
+  template <bool OtherConst,
+            typename = std::enable_if_t<Const && !OtherConst>>
+  Iterator(const Iterator<OtherConst>& other)
+      : current_(other.current_), list_(other.list_) {}
+
+  reference operator*() const { return *current_; }
+  pointer operator->() const { return current_; }
+
+  Iterator& operator++() {
+    current_ = (current_->*Hook).pNext_;
+    return *this;
+  }
+  Iterator operator++(int) {
+    Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+  // from end() to the last element
+  Iterator& operator--() {
+    current_ = current_ != nullptr ? (current_->*Hook).pPrev_ : list_->tail_;
+    return *this;
+  }
+  Iterator operator--(int) {
+    Iterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  bool operator==(const Iterator& other) const {
+    return current_ == other.current_;
+  }
+  bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+ private:
+  friend class intrusive_list;
+  template <bool>
+  friend class Iterator;
+
+  // элемент, на котором стоит итератор, неконстантный для самого листа
+  T* item() const { return const_cast<T*>(current_); }
+
+  pointer current_;
+  list_type* list_;
+};
+
+// связи обнуляются, чтобы элемент можно было снова вставить
+template <typename T, intrusive_list_hook<T> T::*Hook>
+void intrusive_list<T, Hook>::clear() {
+  for (T* item = head_; item != nullptr;) {
+    T* next = hook(item).pNext_;
+    hook(item).pNext_ = nullptr;
+    hook(item).pPrev_ = nullptr;
+    item = next;
+  }
+  head_ = nullptr;
+  tail_ = nullptr;
+  this->count_ = 0;
+}
+
+template <typename T, intrusive_list_hook<T> T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::insert(
+    const_iterator pos, reference value) {
+  T* next = pos.item();
+  T* prev = next != nullptr ? hook(next).pPrev_ : tail_;
+  hook(&value).pNext_ = next;
+  hook(&value).pPrev_ = prev;
+  if (prev != nullptr)
+    hook(prev).pNext_ = &value;
+  else
+    head_ = &value;
+  if (next != nullptr)
+    hook(next).pPrev_ = &value;
+  else
+    tail_ = &value;
+  ++this->count_;
+  return iterator(&value, this);
+}
+
+template <typename T, intrusive_list_hook<T> T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(
+    const_iterator pos) {
+  T* item = pos.item();
+  if (item == nullptr) return end();
+  T* next = hook(item).pNext_;
+  T* prev = hook(item).pPrev_;
+  if (prev != nullptr)
+    hook(prev).pNext_ = next;
+  else
+    head_ = next;
+  if (next != nullptr)
+    hook(next).pPrev_ = prev;
+  else
+    tail_ = prev;
+  hook(item).pNext_ = nullptr;
+  hook(item).pPrev_ = nullptr;
+  --this->count_;
+  return iterator(next, this);
+}
+
+template <typename T, intrusive_list_hook<T> T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(
+    const_iterator first, const_iterator last) {
+  while (first != last) first = erase(first);
+  return iterator(last.item(), this);
+}
+
+template <typename T, intrusive_list_hook<T> T::*Hook>
+void intrusive_list<T, Hook>::pop_back() {
+  if (tail_ == nullptr) throw std::out_of_range("List is empty");
+  erase(const_iterator(tail_, this));
+}
+
+template <typename T, intrusive_list_hook<T> T::*Hook>
+void intrusive_list<T, Hook>::pop_front() {
+  if (head_ == nullptr) throw std::out_of_range("List is empty");
+  erase(begin());
+}
+
+template <typename T, intrusive_list_hook<T> T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos,
+                                     intrusive_list& other) {
+  if (this != &other && other.count_ != 0) {
+    transfer(pos.item(), other, other.head_, other.tail_, other.count_);
+  }
+}
+
+template <typename T, intrusive_list_hook<T> T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos, intrusive_list& other,
+                                     const_iterator it) {
+  T* item = it.item();
+  T* posItem = pos.item();
+  if (item == nullptr) return;
+  // уже стоит перед pos
+  if (this == &other && (item == posItem || hook(item).pNext_ == posItem)) {
+    return;
+  }
+  transfer(posItem, other, item, item, 1);
+}
+
+template <typename T, intrusive_list_hook<T> T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos, intrusive_list& other,
+                                     const_iterator first,
+                                     const_iterator last) {
+  size_type count = 0;
+  // внутри одного листа размер не меняется, считать незачем
+  if (this != &other) {
+    for (const_iterator it = first; it != last; ++it) ++count;
+  }
+  splice(pos, other, first, last, count);
+}
+
+template <typename T, intrusive_list_hook<T> T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos, intrusive_list& other,
+                                     const_iterator first,
+                                     const_iterator last, size_type count) {
+  T* firstItem = first.item();
+  T* lastItem = last.item();
+  if (firstItem == nullptr || firstItem == lastItem) return;
+  T* back = lastItem != nullptr ? hook(lastItem).pPrev_ : other.tail_;
+  transfer(pos.item(), other, firstItem, back, count);
+}
+
+template <typename T, intrusive_list_hook<T> T::*Hook>
+void intrusive_list<T, Hook>::transfer(T* pos, intrusive_list& other,
+                                       T* first, T* last, size_type count) {
+  // вырезаем цепочку из other
+  T* before = hook(first).pPrev_;
+  T* after = hook(last).pNext_;
+  if (before != nullptr)
+    hook(before).pNext_ = after;
+  else
+    other.head_ = after;
+  if (after != nullptr)
+    hook(after).pPrev_ = before;
+  else
+    other.tail_ = before;
+  other.count_ -= count;
+  // и вставляем перед pos
+  T* prev = pos != nullptr ? hook(pos).pPrev_ : tail_;
+  hook(first).pPrev_ = prev;
+  hook(last).pNext_ = pos;
+  if (prev != nullptr)
+    hook(prev).pNext_ = first;
+  else
+    head_ = first;
+  if (pos != nullptr)
+    hook(pos).pPrev_ = last;
+  else
+    tail_ = last;
+  this->count_ += count;
+}
+
+template <typename T, intrusive_list_hook<T> T::*Hook>
+void intrusive_list<T, Hook>::reverse() {
+  for (T* item = head_; item != nullptr; item = hook(item).pPrev_) {
+    std::swap(hook(item).pNext_, hook(item).pPrev_);
+  }
+  std::swap(head_, tail_);
+}
+
+// элементы other вплетаются за один проход, при равенстве первым идёт
+// элемент этого листа
+template <typename T, intrusive_list_hook<T> T::*Hook>
+template <typename Compare>
+void intrusive_list<T, Hook>::merge(intrusive_list& other, Compare comp) {
+  if (this == &other || other.count_ == 0) return;
+  head_ = merge_chains(head_, other.head_, comp);
+  relink_prev();
+  this->count_ += other.count_;
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+  other.count_ = 0;
+}
+
+// как list::sort: в bins[i] лежит отсортированная цепочка из 2^i элементов
+template <typename T, intrusive_list_hook<T> T::*Hook>
+template <typename Compare>
+void intrusive_list<T, Hook>::sort(Compare comp) {
+  if (this->count_ <= 1) return;
+  T* bins[64] = {};
+  T* item = head_;
+  while (item != nullptr) {
+    T* next = hook(item).pNext_;
+    hook(item).pNext_ = nullptr;
+    T* run = item;
+    size_t i = 0;
+    for (; bins[i] != nullptr; ++i) {
+      run = merge_chains(bins[i], run, comp);
+      bins[i] = nullptr;
+    }
+    bins[i] = run;
+    item = next;
+  }
+  T* result = nullptr;
+  for (T* bin : bins) {
+    if (bin != nullptr) result = merge_chains(bin, result, comp);
+  }
+  head_ = result;
+  relink_prev();
+}
+
+template <typename T, intrusive_list_hook<T> T::*Hook>
+template <typename Compare>
+T* intrusive_list<T, Hook>::merge_chains(T* first, T* second, Compare& comp) {
+  T* head = nullptr;
+  T** link = &head;
+  while (first != nullptr && second != nullptr) {
+    if (comp(*second, *first)) {
+      *link = second;
+      second = hook(second).pNext_;
+    } else {
+      *link = first;
+      first = hook(first).pNext_;
+    }
+    link = &hook(*link).pNext_;
+  }
+  *link = first != nullptr ? first : second;
+  return head;
+}
+
+template <typename T, intrusive_list_hook<T> T::*Hook>
+void intrusive_list<T, Hook>::relink_prev() {
+  T* prev = nullptr;
+  for (T* item = head_; item != nullptr; item = hook(item).pNext_) {
+    hook(item).pPrev_ = prev;
+    prev = item;
+  }
+  tail_ = prev;
+}
+
+template <typename T, intrusive_list_hook<T> T::*Hook>
+template <typename Predicate>
+typename intrusive_list<T, Hook>::size_type intrusive_list<T, Hook>::remove_if(
+    Predicate pred) {
+  size_type count = 0;
+  for (iterator it = begin(); it != end();) {
+    if (pred(*it)) {
+      it = erase(it);
+      ++count;
+    } else {
+      ++it;
+    }
+  }
+  return count;
+}
+
+}  // namespace s21
+
+#endif  // S21_INTRUSIVE_LIST_H
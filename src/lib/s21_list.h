@@ -1,12 +1,14 @@
 #ifndef S21_LIST_H
 #define S21_LIST_H
 
+#include <functional>
+
 #include "s21_ordered_list.h"
 
 namespace s21 {
 
-template <typename T>
-class list : public orderedList<T> {
+template <typename T, typename Allocator = NodePool<T>>
+class list : public orderedList<T, Allocator> {
  public:
   // -------------------  обьявление внутреннего класса: итератора
   // -------------------
@@ -20,38 +22,85 @@ class list : public orderedList<T> {
   using iterator = ListIterator;
   using const_iterator = ListConstIterator;
   using size_type = size_t;
-  using Node = typename orderedList<value_type>::Node;
+  using Node = typename orderedList<value_type, Allocator>::Node;
 
   // -------------------  конструкторы и деструкторы -------------------
-  using orderedList<value_type>::orderedList;
+  using orderedList<value_type, Allocator>::orderedList;
 
   // -------------------  методы для работы со списком -------------------
 
   // clears the contents
   void clear();
   // inserts element into concrete pos and returns the iterator that points to
-  // the new element
-  iterator insert(iterator pos, const_reference value);
-  // erases element at pos
-  void erase(iterator pos);
+  // the new element, O(1)
+  iterator insert(iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+  iterator insert(iterator pos, value_type&& value) {
+    return emplace(pos, std::move(value));
+  }
+  // the same, the element is constructed in its node from args
+  template <typename... Args>
+  iterator emplace(iterator pos, Args&&... args);
+  // erases element at pos and returns the iterator following it, O(1)
+  iterator erase(iterator pos);
+  // erases elements [first, last) and returns last
+  iterator erase(iterator first, iterator last);
   // adds an element to the end
-  void push_back(const value_type& data);
+  void push_back(const value_type& data) { emplace_back(data); }
+  void push_back(value_type&& data) { emplace_back(std::move(data)); }
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    return *emplace(end(), std::forward<Args>(args)...);
+  }
   // removes the last element
   void pop_back();
   // adds an element to the head
-  void push_front(const value_type& data);
+  void push_front(const value_type& data) { emplace_front(data); }
+  void push_front(value_type&& data) { emplace_front(std::move(data)); }
+  template <typename... Args>
+  reference emplace_front(Args&&... args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
+  }
   // removes the first element
   void pop_front();
-  // merges two sorted lists
+  // merges two sorted lists by relinking the nodes of other, stable, O(n+m);
+  // other is left empty
   void merge(list& other);
+  // the same for lists sorted by comp
+  template <typename Compare>
+  void merge(list& other, Compare comp);
   // transfers elements from list other starting from pos
   void splice(ListConstIterator pos, list& other);
+  // moves the element at it from other (which may be *this) before pos, O(1)
+  void splice(ListConstIterator pos, list& other, ListConstIterator it);
+  // moves [first, last) from other before pos; pos must not be inside the
+  // range. O(1) within one list, otherwise the range is counted: O(last -
+  // first)
+  void splice(ListConstIterator pos, list& other, ListConstIterator first,
+              ListConstIterator last);
+  // the same with count = distance(first, last) given by the caller, O(1)
+  void splice(ListConstIterator pos, list& other, ListConstIterator first,
+              ListConstIterator last, size_type count);
   // reverses the order of the elements
   void reverse();
-  // removes consecutive duplicate elements
-  void unique();
-  // sorts the elements
+  // removes consecutive duplicate elements, returns their number
+  size_type unique();
+  // the same, an element is a duplicate when pred(kept, element) where kept
+  // is the last element left before it
+  template <typename BinaryPredicate>
+  size_type unique(BinaryPredicate pred);
+  // removes the elements equal to value, returns their number
+  size_type remove(const_reference value);
+  // removes the elements with pred(element), returns their number
+  template <typename Predicate>
+  size_type remove_if(Predicate pred);
+  // sorts the elements with operator<, stable, O(n log n)
   void sort();
+  // the same with comp(a, b) meaning a goes before b; nodes are relinked,
+  // the elements are neither copied nor moved
+  template <typename Compare>
+  void sort(Compare comp);
 
   // -------------Getters-------------------------------------
   reference front() noexcept { return *begin(); };
@@ -82,15 +131,32 @@ class list : public orderedList<T> {
   }
   ListConstIterator end() const { return ListConstIterator(nullptr, *this); }
 
+ protected:
+  // merges two sorted chains linked by pNext_ only, equal elements of first
+  // go first; returns the head of the merged chain
+  template <typename Compare>
+  static Node* merge_chains(Node* first, Node* second, Compare& comp);
+  // head_ is the start of a chain linked by pNext_ only: restores pPrev_ and
+  // tail_
+  void relink_prev();
+  // unlinks in one pass the nodes with drop(kept, node), kept being the last
+  // node left before node (nullptr at the head); the unlinked nodes are freed
+  // together afterwards, so drop may look at any of them. Returns their number
+  template <typename Drop>
+  size_type unlink_where(Drop drop);
+  // unlinks the chain first..last (inclusive) of count nodes from other and
+  // links it before pos (nullptr for the end)
+  void transfer(Node* pos, list& other, Node* first, Node* last,
+                size_type count);
 };  // list
 
 // --------------------------------------- классы
 // итераторов------------------------------------------
 
-template <typename T>
-class list<T>::ListIterator {
+template <typename T, typename Allocator>
+class list<T, Allocator>::ListIterator {
  public:
-  ListIterator(Node* node = nullptr, list<T>& pList = nullptr)
+  ListIterator(Node* node = nullptr, list& pList = nullptr)
       : current(node), pList(pList) {}
   ListIterator(const ListIterator& other)
       : current(other.current), pList(other.pList) {}
@@ -143,13 +209,13 @@ class list<T>::ListIterator {
   // текущий узел, на который указывает итератор
   Node* current;
   // доступ к самому листу для итератора
-  list<T>& pList;
+  list& pList;
 };
 
-template <typename T>
-class list<T>::ListConstIterator {
+template <typename T, typename Allocator>
+class list<T, Allocator>::ListConstIterator {
  public:
-  ListConstIterator(const Node* node, const list<T>& pList)
+  ListConstIterator(const Node* node, const list& pList)
       : current(node), pList(pList) {}
 
   const T& operator*() const { return current->data; }
@@ -193,84 +259,83 @@ class list<T>::ListConstIterator {
   }
 
   const Node* current;
-  const list<T>& pList;
+  const list& pList;
 };
 
 // --------------------------------------- методы
 // листа-------------------------------------
 
-template <typename T>
-void list<T>::erase(iterator pos) {
-  iterator it = this->begin();
-  iterator last = this->end();
-  --last;
-  if (it == pos)
-    pop_front();
-  else if (pos == last)
-    pop_back();
-  else {
-    Node* current = this->head_;
-    Node* tmp;
-    --pos;
-    while (it != pos) {
-      current = current->pNext_;
-      ++it;
-    }
-    tmp = current->pNext_;
-    tmp->pNext_->pPrev_ = current;
-    current->pNext_ = tmp->pNext_;
-    delete tmp;
-    --this->count_;
-  }
+// узел перепривязывается напрямую через pos.current, без прохода от головы
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListIterator list<T, Allocator>::erase(
+    iterator pos) {
+  Node* node = pos.current;
+  if (node == nullptr) return end();
+  this->forget_positions();
+  Node* next = node->pNext_;
+  if (node->pPrev_ != nullptr)
+    node->pPrev_->pNext_ = next;
+  else
+    this->head_ = next;
+  if (next != nullptr)
+    next->pPrev_ = node->pPrev_;
+  else
+    this->tail_ = node->pPrev_;
+  this->destroy_node(node);
+  --this->count_;
+  return iterator(next, *this);
 }
 
-template <typename T>
-typename list<T>::ListIterator list<T>::insert(ListIterator pos,
-                                               const_reference value) {
-  Node* current = this->head_;
-  iterator it = this->begin();
-  // если вначале
-  if (it == pos) {
-    push_front(value);
-    --it;
-  }  // если в конце
-  else if (pos == this->end()) {
-    push_back(value);
-    --it;
-  }  // если по середине
-  else {
-    Node* newNode = new Node(value);
-    --pos;
-    while (it != pos) {
-      ++it;
-      current = current->pNext_;
-    }
-    newNode->pNext_ = current->pNext_;
-    current->pNext_ = newNode;
-    newNode->pPrev_ = current;
-    newNode->pNext_->pPrev_ = newNode;
-    ++it;
-    ++this->count_;
-  }
-  return it;
+// вырезает [first, last) одной перепривязкой, затем удаляет узлы
+template <typename T, typename Allocator>
+typename list<T, Allocator>::ListIterator list<T, Allocator>::erase(
+    iterator first, iterator last) {
+  Node* node = first.current;
+  if (node == nullptr || node == last.current) return last;
+  this->forget_positions();
+  Node* before = node->pPrev_;
+  if (before != nullptr)
+    before->pNext_ = last.current;
+  else
+    this->head_ = last.current;
+  if (last.current != nullptr)
+    last.current->pPrev_ = before;
+  else
+    this->tail_ = before;
+  while (node != last.current) {
+    Node* next = node->pNext_;
+    this->destroy_node(node);
+    --this->count_;
+    node = next;
+  }
+  return last;
 }
 
-template <typename T>
-void list<T>::push_back(const value_type& data) {
-  Node* newNode = new Node(data);
-  if (this->head_ == nullptr) {
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::ListIterator list<T, Allocator>::emplace(
+    ListIterator pos, Args&&... args) {
+  Node* next = pos.current;
+  Node* newNode = this->create_node(std::in_place, std::forward<Args>(args)...);
+  // перед next, а для end() - после хвоста
+  Node* prev = next != nullptr ? next->pPrev_ : this->tail_;
+  if (next != nullptr) this->forget_positions();
+  newNode->pNext_ = next;
+  newNode->pPrev_ = prev;
+  if (prev != nullptr)
+    prev->pNext_ = newNode;
+  else
     this->head_ = newNode;
+  if (next != nullptr)
+    next->pPrev_ = newNode;
+  else
     this->tail_ = newNode;
-  } else {
-    this->tail_->pNext_ = newNode;
-    newNode->pPrev_ = this->tail_;
-    this->tail_ = newNode;
-  }
-  this->count_++;
+  ++this->count_;
+  return iterator(newNode, *this);
 }
 
-template <typename T>
-void list<T>::show_list() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::show_list() {
   Node* current = this->head_;
   if (current == nullptr) std::cout << "empty list\n";
   while (current != nullptr) {
@@ -279,9 +344,10 @@ void list<T>::show_list() {
   }
 }
 
-template <typename T>
-void list<T>::pop_front() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::pop_front() {
   if (this->head_ != nullptr) {
+    this->forget_positions();
     Node* temp = this->head_;
     if (this->head_->pNext_ != nullptr) {
       this->head_ = this->head_->pNext_;
@@ -290,46 +356,34 @@ void list<T>::pop_front() {
       this->head_ = nullptr;
       this->tail_ = nullptr;
     }
-    delete temp;
+    this->destroy_node(temp);
   } else {
     throw std::out_of_range("List is empty");
   }
   this->count_--;
 }
 
-template <typename T>
-void list<T>::pop_back() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::pop_back() {
   if (this->tail_ != nullptr) {
+    this->forget_positions();
     Node* temp = this->tail_;
     if (this->tail_->pPrev_ != nullptr) this->tail_ = this->tail_->pPrev_;
     this->tail_->pNext_ = nullptr;
-    delete temp;
+    this->destroy_node(temp);
   } else {
     throw std::out_of_range("List is empty");
   }
   this->count_--;
 }
 
-template <typename T>
-void list<T>::push_front(const value_type& data) {
-  Node* newNode = new Node(data);
-  if (this->head_ == nullptr) {
-    this->head_ = newNode;
-    this->tail_ = newNode;
-  } else {
-    newNode->pNext_ = this->head_;
-    this->head_->pPrev_ = newNode;
-    this->head_ = newNode;
-  }
-  this->count_++;
-}
-
-template <typename T>
-void list<T>::clear() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::clear() {
+  this->forget_positions();
   Node* current = this->head_;
   while (current != nullptr) {
     Node* next = current->pNext_;
-    delete current;
+    this->destroy_node(current);
     current = next;
   }
   this->head_ = nullptr;
@@ -339,45 +393,87 @@ void list<T>::clear() {
 
 // вставляет все элементы второго списка в указанную позицию первого листа,
 // после этого второй лист зачищается
-template <typename T>
-void list<T>::splice(ListConstIterator pos, list& other) {
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(ListConstIterator pos, list& other) {
   if (this != &other && other.count_ != 0) {
-    Node* posNode = const_cast<Node*>(pos.getCurrent());
-    if (posNode == nullptr) {
-      if (this->count_ == 0) {
-        this->tail_ = other.tail_;
-        this->head_ = other.head_;
-      } else {
-        this->tail_->pNext_ = other.head_;
-        this->tail_ = other.tail_;
-      }
-
-    } else if (posNode == this->head_) {
-      other.tail_->pNext_ = this->head_;
-      this->head_->pPrev_ = other.tail_;
-      this->head_ = other.head_;
+    transfer(const_cast<Node*>(pos.getCurrent()), other, other.head_,
+             other.tail_, other.count_);
+  }
+}
 
-    } else {
-      Node* before = posNode->pPrev_;
-      before->pNext_ = other.head_;
-      other.head_->pPrev_ = before;
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(ListConstIterator pos, list& other,
+                                ListConstIterator it) {
+  Node* node = const_cast<Node*>(it.getCurrent());
+  Node* posNode = const_cast<Node*>(pos.getCurrent());
+  if (node == nullptr) return;
+  // уже стоит перед pos
+  if (this == &other && (node == posNode || node->pNext_ == posNode)) return;
+  transfer(posNode, other, node, node, 1);
+}
 
-      Node* after = posNode;
-      after->pPrev_ = other.tail_;
-      other.tail_->pNext_ = after;
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(ListConstIterator pos, list& other,
+                                ListConstIterator first,
+                                ListConstIterator last) {
+  size_type count = 0;
+  // внутри одного списка размер не меняется, считать незачем
+  if (this != &other) {
+    for (const Node* node = first.getCurrent(); node != last.getCurrent();
+         node = node->pNext_) {
+      ++count;
     }
+  }
+  splice(pos, other, first, last, count);
+}
 
-    this->count_ += other.count_;
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(ListConstIterator pos, list& other,
+                                ListConstIterator first,
+                                ListConstIterator last, size_type count) {
+  Node* firstNode = const_cast<Node*>(first.getCurrent());
+  Node* lastNode = const_cast<Node*>(last.getCurrent());
+  if (firstNode == nullptr || firstNode == lastNode) return;
+  Node* back = lastNode != nullptr ? lastNode->pPrev_ : other.tail_;
+  transfer(const_cast<Node*>(pos.getCurrent()), other, firstNode, back,
+           count);
+}
 
-    other.head_ = nullptr;
-    other.tail_ = nullptr;
-    other.count_ = 0;
-  }
+template <typename T, typename Allocator>
+void list<T, Allocator>::transfer(Node* pos, list& other, Node* first,
+                                  Node* last, size_type count) {
+  if (this != &other) this->adopt_nodes(other);
+  if (pos != nullptr) this->forget_positions();
+  other.forget_positions();
+  // вырезаем цепочку из other
+  if (first->pPrev_ != nullptr)
+    first->pPrev_->pNext_ = last->pNext_;
+  else
+    other.head_ = last->pNext_;
+  if (last->pNext_ != nullptr)
+    last->pNext_->pPrev_ = first->pPrev_;
+  else
+    other.tail_ = first->pPrev_;
+  other.count_ -= count;
+  // и вставляем перед pos, обе связи с каждой стороны
+  Node* prev = pos != nullptr ? pos->pPrev_ : this->tail_;
+  first->pPrev_ = prev;
+  last->pNext_ = pos;
+  if (prev != nullptr)
+    prev->pNext_ = first;
+  else
+    this->head_ = first;
+  if (pos != nullptr)
+    pos->pPrev_ = last;
+  else
+    this->tail_ = last;
+  this->count_ += count;
 }
 
 // меняет голову с хвостом, а также next и prev у кажого узла
-template <typename T>
-void list<T>::reverse() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::reverse() {
+  this->forget_positions();
   Node* current = this->head_;
   Node* prev = nullptr;
   Node* next = nullptr;
@@ -397,84 +493,197 @@ void list<T>::reverse() {
 }
 
 // удаляет последовательно идущие совпадающие элементы
-template <typename T>
-void list<T>::unique() {
-  iterator begin_iterator = begin();
-  iterator end_iterator = end();
-  iterator prev_iterator = begin_iterator;
-
-  ++begin_iterator;
-  while (begin_iterator != end_iterator) {
-    if (*begin_iterator == *prev_iterator) {
-      erase(begin_iterator);
-      begin_iterator = prev_iterator;
+template <typename T, typename Allocator>
+typename list<T, Allocator>::size_type list<T, Allocator>::unique() {
+  return unique(std::equal_to<value_type>());
+}
+
+template <typename T, typename Allocator>
+template <typename BinaryPredicate>
+typename list<T, Allocator>::size_type list<T, Allocator>::unique(
+    BinaryPredicate pred) {
+  return unlink_where([&pred](const Node* kept, const Node* node) {
+    return kept != nullptr && pred(kept->data_, node->data_);
+  });
+}
+
+// value может быть ссылкой на элемент самого листа: узлы удаляются только
+// после прохода, поэтому сравнение с ним остаётся корректным
+template <typename T, typename Allocator>
+typename list<T, Allocator>::size_type list<T, Allocator>::remove(
+    const_reference value) {
+  return remove_if([&value](const_reference data) { return data == value; });
+}
+
+template <typename T, typename Allocator>
+template <typename Predicate>
+typename list<T, Allocator>::size_type list<T, Allocator>::remove_if(
+    Predicate pred) {
+  return unlink_where(
+      [&pred](const Node*, const Node* node) { return pred(node->data_); });
+}
+
+// оставшиеся узлы перепривязываются по ходу, удалённые собираются в цепочку
+// через pNext_ и освобождаются в конце
+template <typename T, typename Allocator>
+template <typename Drop>
+typename list<T, Allocator>::size_type list<T, Allocator>::unlink_where(
+    Drop drop) {
+  this->forget_positions();
+  Node* removed = nullptr;
+  size_type count = 0;
+  Node* kept = nullptr;
+  Node** link = &this->head_;
+  for (Node* node = this->head_; node != nullptr;) {
+    Node* next = node->pNext_;
+    if (drop(kept, node)) {
+      node->pNext_ = removed;
+      removed = node;
+      ++count;
     } else {
-      ++prev_iterator;
+      *link = node;
+      node->pPrev_ = kept;
+      kept = node;
+      link = &node->pNext_;
     }
-    ++begin_iterator;
+    node = next;
   }
+  *link = nullptr;
+  this->tail_ = kept;
+  this->count_ -= count;
+  while (removed != nullptr) {
+    Node* next = removed->pNext_;
+    this->destroy_node(removed);
+    removed = next;
+  }
+  return count;
 }
 
-template <typename T>
-void list<T>::sort() {
-  if (this->count_ <= 1) return;
+template <typename T, typename Allocator>
+void list<T, Allocator>::sort() {
+  sort(std::less<value_type>());
+}
 
-  int swapped = 1;
-  while (swapped) {
-    swapped = 0;
-    Node* current = this->head_;
-    while (current != nullptr && current->pNext_ != nullptr) {
-      if (current->data_ > current->pNext_->data_) {
-        // обмен элементов местами
-        T temp = current->data_;
-        current->data_ = current->pNext_->data_;
-        current->pNext_->data_ = temp;
-        swapped = 1;
-      }
-      current = current->pNext_;
+// сортировка слиянием снизу вверх: bins[i] хранит уже отсортированную цепочку
+// из 2^i узлов, новый узел сливается с занятыми корзинами, как перенос при
+// двоичном сложении. Более ранние узлы всегда в first, поэтому сортировка
+// устойчива
+template <typename T, typename Allocator>
+template <typename Compare>
+void list<T, Allocator>::sort(Compare comp) {
+  if (this->count_ <= 1) return;
+  this->forget_positions();
+  Node* bins[64] = {};
+  Node* node = this->head_;
+  while (node != nullptr) {
+    Node* next = node->pNext_;
+    node->pNext_ = nullptr;
+    Node* run = node;
+    size_t i = 0;
+    for (; bins[i] != nullptr; ++i) {
+      run = merge_chains(bins[i], run, comp);
+      bins[i] = nullptr;
     }
+    bins[i] = run;
+    node = next;
+  }
+  Node* result = nullptr;
+  for (Node* bin : bins) {
+    if (bin != nullptr) result = merge_chains(bin, result, comp);
   }
+  this->head_ = result;
+  relink_prev();
 }
 
-template <typename T>
-void list<T>::merge(list& other) {
-  iterator it = this->begin();
-  while (!other.empty()) {
-    value_type value = std::move(other.front());
-    while (it != this->end() && *it < value) {
-      ++it;
+template <typename T, typename Allocator>
+template <typename Compare>
+typename list<T, Allocator>::Node* list<T, Allocator>::merge_chains(
+    Node* first, Node* second, Compare& comp) {
+  Node* head = nullptr;
+  Node** link = &head;
+  while (first != nullptr && second != nullptr) {
+    if (comp(second->data_, first->data_)) {
+      *link = second;
+      second = second->pNext_;
+    } else {
+      *link = first;
+      first = first->pNext_;
     }
-    this->insert(it, std::move(value));
-    other.pop_front();
+    link = &(*link)->pNext_;
   }
+  *link = first != nullptr ? first : second;
+  return head;
 }
 
-template <typename T>
-template <typename... Args>
-typename list<T>::ListIterator list<T>::insert_many(iterator pos,
-                                                    Args&&... args) {
-  int shift = 0;
-  for (auto& arg : {args...}) {
-    insert(pos, arg);
-    shift++;
+template <typename T, typename Allocator>
+void list<T, Allocator>::relink_prev() {
+  Node* prev = nullptr;
+  for (Node* node = this->head_; node != nullptr; node = node->pNext_) {
+    node->pPrev_ = prev;
+    prev = node;
+  }
+  this->tail_ = prev;
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::merge(list& other) {
+  merge(other, std::less<value_type>());
+}
+
+// узлы other вплетаются между узлами этого листа за один проход, при
+// равенстве первым идёт элемент этого листа; когда одна сторона кончилась,
+// остаток другой присоединяется целиком
+template <typename T, typename Allocator>
+template <typename Compare>
+void list<T, Allocator>::merge(list& other, Compare comp) {
+  if (this == &other || other.count_ == 0) return;
+  this->adopt_nodes(other);
+  this->forget_positions();
+  other.forget_positions();
+  Node* first = this->head_;
+  Node* second = other.head_;
+  Node* prev = nullptr;
+  Node** link = &this->head_;
+  while (first != nullptr && second != nullptr) {
+    Node*& taken = comp(second->data_, first->data_) ? second : first;
+    Node* node = taken;
+    taken = node->pNext_;
+    *link = node;
+    node->pPrev_ = prev;
+    prev = node;
+    link = &node->pNext_;
   }
+  Node* rest = first != nullptr ? first : second;
+  *link = rest;
+  rest->pPrev_ = prev;
+  if (rest == second) this->tail_ = other.tail_;
+  this->count_ += other.count_;
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+  other.count_ = 0;
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::ListIterator list<T, Allocator>::insert_many(
+    iterator pos, Args&&... args) {
+  (emplace(pos, std::forward<Args>(args)), ...);
   iterator buf = pos;
-  for (int i = 0; i < shift; i++) --buf;
+  for (size_type i = 0; i < sizeof...(Args); i++) --buf;
   return buf;
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void list<T>::insert_many_back(Args&&... args) {
-  iterator it = end();
-  (insert(it, std::forward<Args>(args)), ...);
+void list<T, Allocator>::insert_many_back(Args&&... args) {
+  (emplace_back(std::forward<Args>(args)), ...);
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void list<T>::insert_many_front(Args&&... args) {
+void list<T, Allocator>::insert_many_front(Args&&... args) {
   iterator it = begin();
-  (insert(it, std::forward<Args>(args)), ...);
+  (emplace(it, std::forward<Args>(args)), ...);
 }
 
 }  // namespace s21
@@ -1,47 +1,75 @@
 #ifndef S21_MAP_H
 #define S21_MAP_H
 
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <type_traits>
 #include <utility>  // Для std::pair
 #include <vector>
 
+#include "s21_monoid.h"
 #include "s21_tree.h"
 #include "s21_vector.h"
 
 namespace s21 {
 
-template <typename Key, typename Value>
-class map : public Tree<std::pair<Key, Value>> {
+// Applies a monoid over the mapped values to the elements of a map
+template <typename Monoid>
+struct MappedMonoid : Monoid {
+  template <typename Item>
+  typename Monoid::value_type operator()(const Item& item) const {
+    return Monoid::operator()(item.second);
+  }
+};
+
+template <typename Key, typename Value, typename Monoid>
+using MapTree = Tree<
+    std::pair<Key, Value>,
+    std::conditional_t<std::is_void_v<Monoid>, void, MappedMonoid<Monoid>>>;
+
+// With a Monoid (see s21_monoid.h) the map keeps the combination of the
+// values of every subtree and aggregate(lo, hi) takes O(height). operator[],
+// at() and the iterators then give read-only access, values are changed
+// with update() or insert_or_assign, which keep the aggregates up to date.
+template <typename Key, typename Value, typename Monoid = void>
+class map : public MapTree<Key, Value, Monoid> {
  public:
   using key_type = Key;
   using mapped_type = Value;
-  using NodeType = typename Tree<std::pair<Key, Value>>::Node;
+  using tree_type = MapTree<Key, Value, Monoid>;
+  using NodeType = typename tree_type::Node;
   using value_type = std::pair<const Key, Value>;
-  using iterator = typename Tree<std::pair<Key, Value>>::Iterator;
+  using iterator = typename tree_type::Iterator;
   using reference = value_type&;
   using const_reference = const value_type&;
+  using aggregate_type = typename tree_type::aggregate_type;
+  // Value& without a Monoid, const Value& with one
+  using mapped_reference =
+      std::conditional_t<std::is_void_v<Monoid>, Value&, const Value&>;
 
-  using Tree<std::pair<Key, Value>>::Tree;
+  using tree_type::Tree;
 
   std::pair<iterator, bool> insert(const std::pair<const Key, Value>& value) {
-    return this->insert_tree(value,
-                             Tree<std::pair<Key, Value>>::INSERT_NO_DUPLICATE);
+    return this->insert_tree(value, tree_type::INSERT_NO_DUPLICATE);
   }
 
   std::pair<iterator, bool> insert(const Key& key, const Value& obj) {
     return this->insert_tree(std::make_pair(key, obj),
-                             Tree<std::pair<Key, Value>>::INSERT_NO_DUPLICATE);
+                             tree_type::INSERT_NO_DUPLICATE);
   }
 
   std::pair<iterator, bool> insert_or_assign(const Key& key, const Value& obj) {
     return this->insert_tree(std::make_pair(key, obj),
-                             Tree<std::pair<Key, Value>>::INSERT_WITH_UPDATE);
+                             tree_type::INSERT_WITH_UPDATE);
   }
 
   iterator find(const Key& key) {
     NodeType* current = this->root_;
+    NodeType* last = nullptr;
     iterator result = this->end();
     while (current != nullptr) {
+      last = current;
       if (key > current->data.first) {
         current = current->right;
       } else if (current->data.first > key) {
@@ -51,11 +79,14 @@ class map : public Tree<std::pair<Key, Value>> {
         break;
       }
     }
+    if (this->balancing_ == tree_type::SPLAY && last) {
+      this->splay(last);
+    }
     return result;
   }
 
   // Доступ к элементу по ключу
-  Value& at(const Key& key) {
+  mapped_reference at(const Key& key) {
     iterator it = find(key);
     if (it == this->end()) {
       throw std::out_of_range("Key not found");
@@ -64,12 +95,11 @@ class map : public Tree<std::pair<Key, Value>> {
   }
 
   // Доступ или вставка элемента по заданному ключу
-  Value& operator[](const Key& key) {
+  mapped_reference operator[](const Key& key) {
     iterator it = find(key);
     if (it == this->end()) {
-      auto result =
-          this->insert_tree(std::make_pair(key, Value{}),
-                            Tree<std::pair<Key, Value>>::INSERT_WITH_UPDATE);
+      auto result = this->insert_tree(std::make_pair(key, Value{}),
+                                      tree_type::INSERT_WITH_UPDATE);
       if (result.second) {  // Если элемент был вставлен
         it = result.first;
       }
@@ -77,6 +107,29 @@ class map : public Tree<std::pair<Key, Value>> {
     return (*it).second;
   }
 
+  // replaces the value of an existing key and updates the aggregates on the
+  // path to the root, O(height)
+  iterator update(const Key& key, const Value& obj) {
+    iterator it = find(key);
+    if (it == this->end()) {
+      throw std::out_of_range("Key not found");
+    }
+    NodeType* node = it.getNode();
+    node->data.second = obj;
+    this->pull_path(node);
+    return it;
+  }
+
+  using tree_type::aggregate;
+  // combination of the values with key in [lo, hi), in key order
+  aggregate_type aggregate(const Key& lo, const Key& hi) const {
+    return this->aggregate_range(
+        [&lo](const std::pair<Key, Value>& item) { return lo > item.first; },
+        [&hi](const std::pair<Key, Value>& item) {
+          return !(hi > item.first);
+        });
+  }
+
   // Содержит ли map элемент с ключом Key
   bool contains(const Key& key) {
     iterator it = find(key);
@@ -90,7 +143,30 @@ class map : public Tree<std::pair<Key, Value>> {
     return results;
   }
 
+  // Batched lookups: out[i] = find(keys[i]). Several searches advance in
+  // lockstep and prefetch their next node, so the cache misses of
+  // independent searches overlap instead of being paid one after another.
+  void find_many(const Key* keys, size_t count, iterator* out) {
+    probe_many(keys, count, [this, out](size_t i, NodeType* node) {
+      out[i] = iterator(node, *this);
+    });
+  }
+
+  // Sets bit i of bitmap (64 keys per word) when keys[i] is in the map.
+  void contains_many(const Key* keys, size_t count, uint64_t* bitmap) {
+    std::fill(bitmap, bitmap + (count + 63) / 64, 0);
+    probe_many(keys, count, [bitmap](size_t i, NodeType* node) {
+      if (node != nullptr) bitmap[i / 64] |= uint64_t{1} << (i % 64);
+    });
+  }
+
  protected:
+  // number of searches in flight
+  static constexpr size_t kLanes = 8;
+
+  template <typename Visit>
+  void probe_many(const Key* keys, size_t count, Visit visit);
+
   virtual bool const_comparator(
       const std::pair<Key, Value>& data1,
       const std::pair<Key, Value>& data2) const override {
@@ -98,6 +174,53 @@ class map : public Tree<std::pair<Key, Value>> {
   }
 };
 
+template <typename Key, typename Value, typename Monoid>
+template <typename Visit>
+void map<Key, Value, Monoid>::probe_many(const Key* keys, size_t count,
+                                         Visit visit) {
+  NodeType* nodes[kLanes];
+  size_t slots[kLanes];
+  size_t next = 0;
+  size_t active = 0;
+  for (size_t lane = 0; lane < kLanes; ++lane) {
+    if (next < count) {
+      slots[lane] = next;
+      nodes[lane] = this->root_;
+      ++next;
+      ++active;
+    } else {
+      slots[lane] = count;  // idle lane
+      nodes[lane] = nullptr;
+    }
+  }
+
+  while (active != 0) {
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      if (slots[lane] == count) continue;
+      NodeType* node = nodes[lane];
+      const Key& key = keys[slots[lane]];
+      if (node != nullptr && key > node->data.first) {
+        node = node->right;
+      } else if (node != nullptr && node->data.first > key) {
+        node = node->left;
+      } else {
+        // found or fell off the tree, the lane takes the next key
+        visit(slots[lane], node);
+        if (next < count) {
+          slots[lane] = next;
+          node = this->root_;
+          ++next;
+        } else {
+          slots[lane] = count;
+          --active;
+        }
+      }
+      if (node != nullptr) __builtin_prefetch(node);
+      nodes[lane] = node;
+    }
+  }
+}
+
 }  // namespace s21
 
 #endif  // S21_MAP_H
@@ -0,0 +1,210 @@
+#ifndef S21_MAPPED_IMAGE_H
+#define S21_MAPPED_IMAGE_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "s21_container.h"
+
+namespace s21 {
+
+// Key/value record of a mapped_map image. Plain struct, so the image can be
+// used in place without constructing anything.
+template <typename Key, typename Value>
+struct MappedPair {
+  Key first;
+  Value second;
+};
+
+// Read-only sorted array of trivially copyable entries stored in a file and
+// opened with mmap. Nothing is deserialized on open: lookups run directly on
+// the mapped pages, which the page cache shares between processes.
+//
+// File layout: Header followed by `count` entries sorted by key.
+template <typename Entry>
+class MappedImage : public Container<Entry> {
+  static_assert(std::is_trivially_copyable<Entry>::value,
+                "mapped image entries must be trivially copyable");
+  static_assert(alignof(Entry) <= alignof(uint64_t),
+                "entries are stored right after the 8-byte aligned header");
+
+ public:
+  using value_type = Entry;
+  using const_reference = const Entry&;
+  using iterator = const Entry*;
+  using const_iterator = const Entry*;
+  using size_type = size_t;
+
+  struct Header {
+    char magic[8];
+    uint64_t entry_size;
+    uint64_t count;
+  };
+
+  // Streams sorted entries into an image file. They go to a temporary file
+  // next to it, which finish() renames over path: an image mapped by another
+  // process or mapped_map stays intact, and readers see either the old image
+  // or the complete new one. Without finish() the temporary file is removed.
+  class Writer {
+   public:
+    explicit Writer(const std::string& path);
+    Writer(const Writer&) = delete;
+    Writer& operator=(const Writer&) = delete;
+    ~Writer();
+    void push(const Entry& entry) {
+      out_.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+      ++header_.count;
+    }
+    // completes the header, returns the number of written entries
+    size_t finish();
+
+   private:
+    std::ofstream out_;
+    std::string path_;
+    std::string temp_path_;
+    Header header_{};
+  };
+
+  MappedImage() : map_(nullptr), map_size_(0), data_(nullptr) {}
+  explicit MappedImage(const std::string& path) : MappedImage() { open(path); }
+  MappedImage(const MappedImage&) = delete;
+  MappedImage(MappedImage&& other) : MappedImage() { swap(other); }
+  MappedImage& operator=(const MappedImage&) = delete;
+  MappedImage& operator=(MappedImage&& other) {
+    if (this != &other) {
+      close();
+      swap(other);
+    }
+    return *this;
+  }
+  virtual ~MappedImage() { close(); }
+
+  void open(const std::string& path);
+  void close();
+  bool is_open() const { return map_ != nullptr; }
+
+  const_iterator begin() const { return data_; }
+  const_iterator end() const { return data_ + this->count_; }
+
+  void swap(MappedImage& other) {
+    std::swap(map_, other.map_);
+    std::swap(map_size_, other.map_size_);
+    std::swap(data_, other.data_);
+    std::swap(this->count_, other.count_);
+  }
+
+  size_type max_size() override { return this->count_; }
+
+ protected:
+  static constexpr char kMagic[8] = {'S', '2', '1', 'I', 'M', 'G', '1', '\0'};
+
+  // writes entries [first, last) produced by convert, input must be sorted
+  template <typename InputIt, typename Convert>
+  static void write_image(const std::string& path, InputIt first,
+                          InputIt last, Convert convert);
+
+  void* map_;
+  size_t map_size_;
+  const Entry* data_;
+};
+
+template <typename Entry>
+constexpr char MappedImage<Entry>::kMagic[8];
+
+template <typename Entry>
+void MappedImage<Entry>::open(const std::string& path) {
+  close();
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) throw std::runtime_error("cannot open image " + path);
+  struct stat st;
+  if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Header)) {
+    ::close(fd);
+    throw std::runtime_error("invalid image " + path);
+  }
+  void* map = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (map == MAP_FAILED) throw std::runtime_error("cannot map image " + path);
+
+  const Header* header = static_cast<const Header*>(map);
+  if (std::memcmp(header->magic, kMagic, sizeof(kMagic)) != 0 ||
+      header->entry_size != sizeof(Entry) ||
+      header->count > (st.st_size - sizeof(Header)) / sizeof(Entry)) {
+    munmap(map, st.st_size);
+    throw std::runtime_error("invalid image " + path);
+  }
+  map_ = map;
+  map_size_ = st.st_size;
+  data_ = reinterpret_cast<const Entry*>(header + 1);
+  this->count_ = header->count;
+}
+
+template <typename Entry>
+void MappedImage<Entry>::close() {
+  if (map_ != nullptr) munmap(map_, map_size_);
+  map_ = nullptr;
+  map_size_ = 0;
+  data_ = nullptr;
+  this->count_ = 0;
+}
+
+template <typename Entry>
+MappedImage<Entry>::Writer::Writer(const std::string& path)
+    : path_(path), temp_path_(path + ".XXXXXX") {
+  // в том же каталоге, чтобы rename был атомарным
+  int fd = mkstemp(&temp_path_[0]);
+  if (fd < 0) throw std::runtime_error("cannot create image " + path);
+  fchmod(fd, 0644);
+  ::close(fd);
+  out_.open(temp_path_, std::ios::binary | std::ios::trunc);
+  if (!out_) {
+    std::remove(temp_path_.c_str());
+    throw std::runtime_error("cannot create image " + path);
+  }
+  std::memcpy(header_.magic, kMagic, sizeof(kMagic));
+  header_.entry_size = sizeof(Entry);
+  out_.write(reinterpret_cast<const char*>(&header_), sizeof(header_));
+}
+
+template <typename Entry>
+size_t MappedImage<Entry>::Writer::finish() {
+  // the count is known only after the pass, patch the header
+  out_.seekp(0);
+  out_.write(reinterpret_cast<const char*>(&header_), sizeof(header_));
+  out_.close();
+  if (!out_ || std::rename(temp_path_.c_str(), path_.c_str()) != 0) {
+    throw std::runtime_error("cannot write image " + path_);
+  }
+  temp_path_.clear();
+  return header_.count;
+}
+
+template <typename Entry>
+MappedImage<Entry>::Writer::~Writer() {
+  if (temp_path_.empty()) return;
+  out_.close();
+  std::remove(temp_path_.c_str());
+}
+
+template <typename Entry>
+template <typename InputIt, typename Convert>
+void MappedImage<Entry>::write_image(const std::string& path, InputIt first,
+                                     InputIt last, Convert convert) {
+  Writer writer(path);
+  for (; first != last; ++first) writer.push(convert(*first));
+  writer.finish();
+}
+
+}  // namespace s21
+
+#endif  // S21_MAPPED_IMAGE_H
@@ -0,0 +1,80 @@
+#ifndef S21_MAPPED_MAP_H
+#define S21_MAPPED_MAP_H
+
+#include <utility>  // Для std::pair
+
+#include "s21_map.h"
+#include "s21_mapped_image.h"
+
+namespace s21 {
+
+// Read-only map backed by a memory-mapped image written by mapped_map::write.
+template <typename Key, typename Value>
+class mapped_map : public MappedImage<MappedPair<Key, Value>> {
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = MappedPair<Key, Value>;
+  using image_type = MappedImage<value_type>;
+  using iterator = typename image_type::iterator;
+  using const_iterator = typename image_type::const_iterator;
+
+  using image_type::MappedImage;
+
+  // serializes a map into an image file
+  static void write(const std::string& path, const map<Key, Value>& m) {
+    write(path, m.begin(), m.end());
+  }
+  // serializes a range of pairs sorted by unique key into an image file
+  template <typename InputIt>
+  static void write(const std::string& path, InputIt first, InputIt last) {
+    image_type::write_image(path, first, last,
+                            [](const std::pair<Key, Value>& item) {
+                              return value_type{item.first, item.second};
+                            });
+  }
+
+  // first element with key not less than key
+  const_iterator lower_bound(const Key& key) const {
+    const value_type* first = this->begin();
+    size_t len = this->count_;
+    while (len > 0) {
+      size_t half = len / 2;
+      if (key > first[half].first) {
+        first += half + 1;
+        len -= half + 1;
+      } else {
+        len = half;
+      }
+    }
+    return first;
+  }
+
+  // first element with key greater than key
+  const_iterator upper_bound(const Key& key) const {
+    const_iterator it = lower_bound(key);
+    return (it != this->end() && !(it->first > key)) ? it + 1 : it;
+  }
+
+  const_iterator find(const Key& key) const {
+    const_iterator it = lower_bound(key);
+    return (it != this->end() && !(it->first > key)) ? it : this->end();
+  }
+
+  bool contains(const Key& key) const { return find(key) != this->end(); }
+
+  // Доступ к элементу по ключу
+  const Value& at(const Key& key) const {
+    const_iterator it = find(key);
+    if (it == this->end()) {
+      throw std::out_of_range("Key not found");
+    }
+    return it->second;
+  }
+
+  const Value& operator[](const Key& key) const { return at(key); }
+};
+
+}  // namespace s21
+
+#endif  // S21_MAPPED_MAP_H
@@ -0,0 +1,64 @@
+#ifndef S21_MAPPED_SET_H
+#define S21_MAPPED_SET_H
+
+#include "s21_mapped_image.h"
+#include "s21_set.h"
+
+namespace s21 {
+
+// Read-only set backed by a memory-mapped image written by mapped_set::write.
+template <typename Key>
+class mapped_set : public MappedImage<Key> {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using image_type = MappedImage<Key>;
+  using iterator = typename image_type::iterator;
+  using const_iterator = typename image_type::const_iterator;
+
+  using image_type::MappedImage;
+
+  // serializes a set into an image file
+  static void write(const std::string& path, const set<Key>& s) {
+    write(path, s.begin(), s.end());
+  }
+  // serializes a sorted range of unique keys into an image file
+  template <typename InputIt>
+  static void write(const std::string& path, InputIt first, InputIt last) {
+    image_type::write_image(path, first, last,
+                            [](const Key& key) { return key; });
+  }
+
+  // first element not less than key
+  const_iterator lower_bound(const Key& key) const {
+    const Key* first = this->begin();
+    size_t len = this->count_;
+    while (len > 0) {
+      size_t half = len / 2;
+      if (key > first[half]) {
+        first += half + 1;
+        len -= half + 1;
+      } else {
+        len = half;
+      }
+    }
+    return first;
+  }
+
+  // first element greater than key
+  const_iterator upper_bound(const Key& key) const {
+    const_iterator it = lower_bound(key);
+    return (it != this->end() && !(*it > key)) ? it + 1 : it;
+  }
+
+  const_iterator find(const Key& key) const {
+    const_iterator it = lower_bound(key);
+    return (it != this->end() && !(*it > key)) ? it : this->end();
+  }
+
+  bool contains(const Key& key) const { return find(key) != this->end(); }
+};
+
+}  // namespace s21
+
+#endif  // S21_MAPPED_SET_H
@@ -0,0 +1,52 @@
+#ifndef S21_MONOID_H
+#define S21_MONOID_H
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+
+namespace s21 {
+
+// Monoids for the augmented Tree (see Tree::aggregate). A monoid has a
+// value_type, an identity() element, an associative combine(a, b) and an
+// operator() that turns an element into a value. combine does not have to
+// be commutative, elements are always combined in key order.
+
+template <typename T>
+struct Sum {
+  using value_type = T;
+  value_type identity() const { return T{}; }
+  value_type combine(const T& a, const T& b) const { return a + b; }
+  value_type operator()(const T& item) const { return item; }
+};
+
+template <typename T>
+struct Min {
+  using value_type = T;
+  value_type identity() const { return std::numeric_limits<T>::max(); }
+  value_type combine(const T& a, const T& b) const { return std::min(a, b); }
+  value_type operator()(const T& item) const { return item; }
+};
+
+template <typename T>
+struct Max {
+  using value_type = T;
+  value_type identity() const { return std::numeric_limits<T>::lowest(); }
+  value_type combine(const T& a, const T& b) const { return std::max(a, b); }
+  value_type operator()(const T& item) const { return item; }
+};
+
+// number of elements
+struct Count {
+  using value_type = std::size_t;
+  value_type identity() const { return 0; }
+  value_type combine(value_type a, value_type b) const { return a + b; }
+  template <typename Item>
+  value_type operator()(const Item&) const {
+    return 1;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_MONOID_H
@@ -0,0 +1,389 @@
+#ifndef S21_MULTIMAP_H
+#define S21_MULTIMAP_H
+
+#include <cstddef>
+#include <new>
+#include <utility>  // Для std::pair
+#include <vector>
+
+#include "s21_tree.h"
+
+namespace s21 {
+
+// Tree with one node per (key, value); equal keys keep their insertion order.
+template <typename Key, typename Value>
+class multimap : public Tree<std::pair<Key, Value>> {
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<const Key, Value>;
+  using tree_type = Tree<std::pair<Key, Value>>;
+  using NodeType = typename tree_type::Node;
+  using iterator = typename tree_type::Iterator;
+  using const_iterator = typename tree_type::ConstIterator;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = std::size_t;
+
+  using tree_type::Tree;
+
+  // after the elements with an equal key
+  iterator insert(const value_type& value) {
+    return this->insert_tree(value, tree_type::INSERT_DUPLICATES).first;
+  }
+  iterator insert(const Key& key, const Value& obj) {
+    return insert(value_type(key, obj));
+  }
+  // right before hint when the key fits there, without a search; otherwise
+  // like insert(value). Inserting in key order with hint end() is O(1)
+  // amortized plus the walk to the last node.
+  iterator insert(iterator hint, const value_type& value);
+
+  // first element with the key
+  iterator find(const Key& key) {
+    iterator it = lower_bound(key);
+    return it != this->end() && (*it).first > key ? this->end() : it;
+  }
+  bool contains(const Key& key) { return find(key) != this->end(); }
+  size_type count(const Key& key);
+
+  // first element with a key not less than key
+  iterator lower_bound(const Key& key) { return bound(key, false); }
+  // first element with a key greater than key
+  iterator upper_bound(const Key& key) { return bound(key, true); }
+  std::pair<iterator, iterator> equal_range(const Key& key) {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  // removes every element with the key, returns their number
+  size_type erase(const Key& key);
+  using tree_type::erase;
+
+  void merge(tree_type& other) override {
+    if (this != &other) {
+      for (auto it = other.begin(); it != other.end(); ++it) {
+        this->insert_tree(*it, tree_type::INSERT_DUPLICATES);
+      }
+      other.clear();
+    }
+  }
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    std::vector<std::pair<iterator, bool>> results;
+    (void)(results.push_back(
+               std::make_pair(insert(std::forward<Args>(args)), true)),
+           ...);
+    return results;
+  }
+
+ protected:
+  iterator bound(const Key& key, bool upper);
+
+  bool const_comparator(const std::pair<Key, Value>& data1,
+                        const std::pair<Key, Value>& data2) const override {
+    return data1.first > data2.first;
+  }
+};
+
+template <typename Key, typename Value>
+typename multimap<Key, Value>::iterator multimap<Key, Value>::insert(
+    iterator hint, const value_type& value) {
+  NodeType* position = hint.getNode();
+  // the key must lie between the keys before and at hint
+  bool fits = position == nullptr || !(value.first > position->data.first);
+  if (fits && hint != this->begin()) {
+    iterator prev = hint;
+    --prev;
+    fits = !((*prev).first > value.first);
+  }
+  if (!fits) return insert(value);
+  return this->insert_before(position, value);
+}
+
+template <typename Key, typename Value>
+typename multimap<Key, Value>::iterator multimap<Key, Value>::bound(
+    const Key& key, bool upper) {
+  NodeType* current = this->root_;
+  NodeType* result = nullptr;
+  while (current != nullptr) {
+    bool right = upper ? !(current->data.first > key)
+                       : key > current->data.first;
+    if (right) {
+      current = current->right;
+    } else {
+      result = current;
+      current = current->left;
+    }
+  }
+  return iterator(result, *this);
+}
+
+template <typename Key, typename Value>
+typename multimap<Key, Value>::size_type multimap<Key, Value>::count(
+    const Key& key) {
+  size_type result = 0;
+  for (iterator it = lower_bound(key);
+       it != this->end() && !((*it).first > key); ++it) {
+    ++result;
+  }
+  return result;
+}
+
+template <typename Key, typename Value>
+typename multimap<Key, Value>::size_type multimap<Key, Value>::erase(
+    const Key& key) {
+  size_type result = 0;
+  // erase() may move the next element into the erased node, search again
+  for (iterator it = find(key); it != this->end(); it = find(key)) {
+    tree_type::erase(it);
+    ++result;
+  }
+  return result;
+}
+
+// Values of one key of a grouped_multimap: the first InlineCount live in
+// the group itself, a larger group moves them all to one heap array.
+template <typename Value, std::size_t InlineCount>
+class ValueGroup {
+ public:
+  using size_type = std::size_t;
+  static_assert(InlineCount > 0, "ValueGroup needs inline room");
+
+  ValueGroup() = default;
+  ValueGroup(const ValueGroup& other) {
+    for (const Value& value : other) push_back(value);
+  }
+  ValueGroup(ValueGroup&& other) noexcept { take(other); }
+  ~ValueGroup() { release(); }
+
+  ValueGroup& operator=(const ValueGroup& other) {
+    if (this != &other) {
+      ValueGroup copy(other);
+      release();
+      take(copy);
+    }
+    return *this;
+  }
+  ValueGroup& operator=(ValueGroup&& other) noexcept {
+    if (this != &other) {
+      release();
+      take(other);
+    }
+    return *this;
+  }
+
+  Value* begin() { return data(); }
+  Value* end() { return data() + size_; }
+  const Value* begin() const { return data(); }
+  const Value* end() const { return data() + size_; }
+  Value& operator[](size_type index) { return data()[index]; }
+  size_type size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  void push_back(const Value& value);
+  // keeps the order of the remaining values
+  void erase(size_type index);
+
+ private:
+  Value* data() {
+    return heap_ != nullptr ? heap_ : reinterpret_cast<Value*>(inline_);
+  }
+  const Value* data() const {
+    return heap_ != nullptr ? heap_ : reinterpret_cast<const Value*>(inline_);
+  }
+  // destroys the values and frees the heap array, leaves an empty group
+  void release();
+  // moves the values of other into this empty group, empties other
+  void take(ValueGroup& other);
+
+  alignas(Value) unsigned char inline_[InlineCount * sizeof(Value)];
+  Value* heap_ = nullptr;
+  size_type size_ = 0;
+  size_type capacity_ = InlineCount;
+};
+
+template <typename Value, std::size_t InlineCount>
+void ValueGroup<Value, InlineCount>::push_back(const Value& value) {
+  if (size_ == capacity_) {
+    Value* grown =
+        static_cast<Value*>(::operator new(2 * capacity_ * sizeof(Value)));
+    Value* old = data();
+    for (size_type i = 0; i < size_; ++i) {
+      new (grown + i) Value(std::move(old[i]));
+      old[i].~Value();
+    }
+    ::operator delete(heap_);
+    heap_ = grown;
+    capacity_ *= 2;
+  }
+  new (data() + size_) Value(value);
+  ++size_;
+}
+
+template <typename Value, std::size_t InlineCount>
+void ValueGroup<Value, InlineCount>::erase(size_type index) {
+  Value* values = data();
+  for (size_type i = index + 1; i < size_; ++i) {
+    values[i - 1] = std::move(values[i]);
+  }
+  values[--size_].~Value();
+}
+
+template <typename Value, std::size_t InlineCount>
+void ValueGroup<Value, InlineCount>::release() {
+  Value* values = data();
+  for (size_type i = 0; i < size_; ++i) values[i].~Value();
+  ::operator delete(heap_);
+  heap_ = nullptr;
+  size_ = 0;
+  capacity_ = InlineCount;
+}
+
+template <typename Value, std::size_t InlineCount>
+void ValueGroup<Value, InlineCount>::take(ValueGroup& other) {
+  if (other.heap_ != nullptr) {
+    heap_ = other.heap_;
+    capacity_ = other.capacity_;
+    size_ = other.size_;
+    other.heap_ = nullptr;
+    other.size_ = 0;
+    other.capacity_ = InlineCount;
+    return;
+  }
+  for (Value& value : other) {
+    new (data() + size_) Value(std::move(value));
+    ++size_;
+  }
+  other.release();
+}
+
+// multimap that keeps all values of a key contiguously in one node (see
+// ValueGroup): one allocation per key instead of one per value, and the
+// values of a key are read without hopping between nodes. Iterators visit
+// the keys, (*it).second is the group. size() counts keys.
+template <typename Key, typename Value, std::size_t InlineCount = 4>
+class grouped_multimap
+    : public Tree<std::pair<Key, ValueGroup<Value, InlineCount>>> {
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using group_type = ValueGroup<Value, InlineCount>;
+  using value_type = std::pair<Key, group_type>;
+  using tree_type = Tree<value_type>;
+  using NodeType = typename tree_type::Node;
+  using iterator = typename tree_type::Iterator;
+  using const_iterator = typename tree_type::ConstIterator;
+  using size_type = std::size_t;
+
+  using tree_type::Tree;
+
+  // appends obj to the group of key, returns the group
+  iterator insert(const Key& key, const Value& obj) {
+    iterator it = find(key);
+    if (it == this->end()) {
+      it = this->insert_tree(value_type(key, group_type()),
+                             tree_type::INSERT_NO_DUPLICATE)
+               .first;
+    }
+    (*it).second.push_back(obj);
+    return it;
+  }
+  iterator insert(const std::pair<const Key, Value>& value) {
+    return insert(value.first, value.second);
+  }
+
+  // the group of the key
+  iterator find(const Key& key) {
+    NodeType* current = this->root_;
+    while (current != nullptr) {
+      if (key > current->data.first) {
+        current = current->right;
+      } else if (current->data.first > key) {
+        current = current->left;
+      } else {
+        break;
+      }
+    }
+    return iterator(current, *this);
+  }
+  bool contains(const Key& key) { return find(key) != this->end(); }
+  size_type count(const Key& key) {
+    iterator it = find(key);
+    return it == this->end() ? 0 : (*it).second.size();
+  }
+  // the values of the key, contiguous and in insertion order
+  std::pair<Value*, Value*> equal_range(const Key& key) {
+    iterator it = find(key);
+    if (it == this->end()) return {nullptr, nullptr};
+    return {(*it).second.begin(), (*it).second.end()};
+  }
+
+  // first group with a key not less than key
+  iterator lower_bound(const Key& key) {
+    NodeType* current = this->root_;
+    NodeType* result = nullptr;
+    while (current != nullptr) {
+      if (key > current->data.first) {
+        current = current->right;
+      } else {
+        result = current;
+        current = current->left;
+      }
+    }
+    return iterator(result, *this);
+  }
+  // first group with a key greater than key
+  iterator upper_bound(const Key& key) {
+    NodeType* current = this->root_;
+    NodeType* result = nullptr;
+    while (current != nullptr) {
+      if (!(current->data.first > key)) {
+        current = current->right;
+      } else {
+        result = current;
+        current = current->left;
+      }
+    }
+    return iterator(result, *this);
+  }
+
+  // number of values of all keys, O(keys)
+  size_type value_count() {
+    size_type result = 0;
+    for (auto it = this->begin(); it != this->end(); ++it) {
+      result += (*it).second.size();
+    }
+    return result;
+  }
+
+  // removes the group of the key, returns the number of its values
+  size_type erase(const Key& key) {
+    iterator it = find(key);
+    if (it == this->end()) return 0;
+    size_type result = (*it).second.size();
+    tree_type::erase(it);
+    return result;
+  }
+  using tree_type::erase;
+
+  // appends the values of other to the groups of their keys
+  void merge(tree_type& other) override {
+    if (this != &other) {
+      for (auto it = other.begin(); it != other.end(); ++it) {
+        for (const Value& value : (*it).second) insert((*it).first, value);
+      }
+      other.clear();
+    }
+  }
+
+ protected:
+  bool const_comparator(const value_type& data1,
+                        const value_type& data2) const override {
+    return data1.first > data2.first;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_MULTIMAP_H
@@ -0,0 +1,139 @@
+#ifndef S21_NODE_POOL_H
+#define S21_NODE_POOL_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+// Allocator for one object at a time, meant for the nodes of one container.
+// Freed nodes go to a free list and are handed out again before the pool
+// carves new ones from its chunks; a chunk holds FirstChunk nodes at first
+// and each next one twice as many, up to 4096. The memory is given back
+// when the pool is destroyed. A copy of a pool starts empty, so every
+// container owns its pool; allocations of more than one object go to
+// operator new.
+template <typename T, std::size_t FirstChunk = 16>
+class NodePool {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using propagate_on_container_swap = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  template <typename U>
+  struct rebind {
+    using other = NodePool<U, FirstChunk>;
+  };
+
+  NodePool() = default;
+  NodePool(const NodePool&) {}
+  template <typename U>
+  NodePool(const NodePool<U, FirstChunk>&) {}
+  NodePool(NodePool&& other) noexcept { swap(other); }
+  NodePool& operator=(NodePool other) noexcept {
+    swap(other);
+    return *this;
+  }
+
+  T* allocate(size_type n);
+  void deallocate(T* pointer, size_type n) noexcept;
+
+  // shares the chunks of other: nodes of other may then be moved into the
+  // container of this pool (splice, merge) and be freed here
+  void adopt(const NodePool& other) {
+    share(other.chunks_);
+    for (const auto& chunks : other.adopted_) share(chunks);
+  }
+
+  void swap(NodePool& other) noexcept {
+    std::swap(free_, other.free_);
+    std::swap(cursor_, other.cursor_);
+    std::swap(chunk_end_, other.chunk_end_);
+    std::swap(next_chunk_, other.next_chunk_);
+    chunks_.swap(other.chunks_);
+    adopted_.swap(other.adopted_);
+  }
+
+  // only a pool frees what it allocated
+  bool operator==(const NodePool& other) const { return this == &other; }
+  bool operator!=(const NodePool& other) const { return this != &other; }
+
+ private:
+  union Slot {
+    Slot* next;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  struct Chunks {
+    std::vector<std::unique_ptr<Slot[]>> blocks;
+  };
+
+  static constexpr size_type kMaxChunk = 4096;
+
+  void share(const std::shared_ptr<Chunks>& chunks) {
+    if (chunks == nullptr || chunks == chunks_) return;
+    for (const auto& held : adopted_) {
+      if (held == chunks) return;
+    }
+    adopted_.push_back(chunks);
+  }
+
+  // свободные узлы, связанные через next
+  Slot* free_ = nullptr;
+  // ещё не выданная часть последнего блока
+  Slot* cursor_ = nullptr;
+  Slot* chunk_end_ = nullptr;
+  size_type next_chunk_ = FirstChunk;
+  // свои блоки; общие с пулами, которые их приняли (adopt)
+  std::shared_ptr<Chunks> chunks_;
+  // блоки других пулов, узлы которых перешли к этому
+  std::vector<std::shared_ptr<Chunks>> adopted_;
+};
+
+template <typename T, std::size_t FirstChunk>
+T* NodePool<T, FirstChunk>::allocate(size_type n) {
+  if (n != 1) return static_cast<T*>(::operator new(n * sizeof(T)));
+  Slot* slot = free_;
+  if (slot != nullptr) {
+    free_ = slot->next;
+  } else {
+    if (cursor_ == chunk_end_) {
+      if (chunks_ == nullptr) chunks_ = std::make_shared<Chunks>();
+      chunks_->blocks.emplace_back(new Slot[next_chunk_]);
+      cursor_ = chunks_->blocks.back().get();
+      chunk_end_ = cursor_ + next_chunk_;
+      if (next_chunk_ < kMaxChunk) next_chunk_ *= 2;
+    }
+    slot = cursor_++;
+  }
+  return reinterpret_cast<T*>(slot->storage);
+}
+
+template <typename T, std::size_t FirstChunk>
+void NodePool<T, FirstChunk>::deallocate(T* pointer, size_type n) noexcept {
+  if (n != 1) {
+    ::operator delete(pointer);
+    return;
+  }
+  Slot* slot = reinterpret_cast<Slot*>(pointer);
+  slot->next = free_;
+  free_ = slot;
+}
+
+// allocators whose nodes may move to a container with another allocator
+// object only after adopt()
+template <typename Allocator, typename = void>
+struct AdoptsNodes : std::false_type {};
+template <typename Allocator>
+struct AdoptsNodes<Allocator,
+                   std::void_t<decltype(std::declval<Allocator&>().adopt(
+                       std::declval<const Allocator&>()))>>
+    : std::true_type {};
+
+}  // namespace s21
+
+#endif  // S21_NODE_POOL_H
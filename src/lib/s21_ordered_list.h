@@ -2,17 +2,25 @@
 #define S21_ORDERED_orederedList_H
 
 #include <iostream>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "s21_container.h"
+#include "s21_node_pool.h"
 
 namespace s21 {
-template <typename T>
+// Allocator выделяет узлы (через rebind); по умолчанию у каждого контейнера
+// свой пул узлов, который переиспользует освобождённые узлы
+template <typename T, typename Allocator = NodePool<T>>
 class orderedList : public Container<T> {
  public:
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
   // -------------------  конструкторы и деструкторы -------------------
   // default constructor, creates empty orderedList
@@ -34,8 +42,18 @@ class orderedList : public Container<T> {
   orderedList &operator=(orderedList &&l);
   // destructor
   ~orderedList();
-  // получение элемента по индексу
+  // получение элемента по индексу: проход от ближайшего из головы, хвоста и
+  // последнего найденного узла, поэтому обход подряд - O(1) на шаг
   reference operator[](size_type ind);
+  // with indexed on, operator[] also starts from every kCheckpointStride-th
+  // node, kept in a vector rebuilt on the first access after a change of
+  // the order: random access costs O(kCheckpointStride)
+  void set_indexed(bool indexed) {
+    indexed_ = indexed;
+    checkpoints_valid_ = false;
+    std::vector<Node *>().swap(checkpoints_);
+  }
+  bool indexed() const { return indexed_; }
   // распечатка для себя
   void print() const {
     Node *current = head_;
@@ -54,6 +72,7 @@ class orderedList : public Container<T> {
   }
   // swaps the contents
   void swap(orderedList &other);
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
 
   // Для наследуемых классов определены классы, методы и поля
   // класс узел
@@ -67,30 +86,72 @@ class orderedList : public Container<T> {
     explicit Node(const value_type &data_ = value_type(),
                   Node *pNext_ = nullptr, Node *pPrev_ = nullptr)
         : data_(data_), pNext_(pNext_), pPrev_(pPrev_) {}
+    // элемент строится прямо в узле из аргументов его конструктора
+    template <typename... Args>
+    explicit Node(std::in_place_t, Args &&...args)
+        : data_(std::forward<Args>(args)...),
+          pNext_(nullptr),
+          pPrev_(nullptr) {}
   };
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
   // указатель на голову
   Node *head_{};
   // указатель на конец
   Node *tail_{};
+  // выделяет узлы этого контейнера
+  node_allocator alloc_;
+
+  template <typename... Args>
+  Node *create_node(Args &&...args);
+  void destroy_node(Node *node) noexcept {
+    node_traits::destroy(alloc_, node);
+    node_traits::deallocate(alloc_, node, 1);
+  }
+  // узлы other переходят в этот контейнер (splice, merge): пул должен
+  // держать их память и после того, как other будет уничтожен
+  void adopt_nodes(orderedList &other);
+
+  static constexpr size_type kCheckpointStride = 32;
+  // последний найденный operator[] узел и его индекс
+  Node *finger_ = nullptr;
+  size_type finger_index_ = 0;
+  // каждый kCheckpointStride-й узел, если indexed_
+  std::vector<Node *> checkpoints_;
+  bool indexed_ = false;
+  bool checkpoints_valid_ = false;
+  // вызывается при любом изменении, сдвигающем индексы или удаляющем узлы;
+  // добавление в конец индексы не сдвигает
+  void forget_positions() {
+    finger_ = nullptr;
+    checkpoints_valid_ = false;
+  }
 
   // access the first element
-  const_reference front() {
+  reference front() {
     if (head_ == nullptr) throw ::std::range_error("\nempty orderedlist\n");
-    return (const_reference)head_->data_;
+    return head_->data_;
   }
   // access the last element
-  const_reference back() {
+  reference back() {
     if (tail_ == nullptr) throw ::std::range_error("\nempty orderedlist\n");
-    return (const_reference)tail_->data_;
+    return tail_->data_;
   }
 
-  void push_back(const_reference value);
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+  // constructs the element at the end from args
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
 };
 
 }  // namespace s21
 
-template <typename T>
-s21::orderedList<T>::orderedList(const orderedList &l) {
+template <typename T, typename Allocator>
+s21::orderedList<T, Allocator>::orderedList(const orderedList &l)
+    : alloc_(node_traits::select_on_container_copy_construction(l.alloc_)) {
   Node *current = l.head_;
   while (current != nullptr) {
     push_back(current->data_);
@@ -98,62 +159,92 @@ s21::orderedList<T>::orderedList(const orderedList &l) {
   }
 }
 
-template <typename T>
-s21::orderedList<T>::orderedList(orderedList &&l) {
+template <typename T, typename Allocator>
+s21::orderedList<T, Allocator>::orderedList(orderedList &&l)
+    : alloc_(std::move(l.alloc_)) {
   this->count_ = l.count_;
   head_ = l.head_;
   tail_ = l.tail_;
   l.count_ = 0;
   l.head_ = nullptr;
   l.tail_ = nullptr;
+  l.forget_positions();
 }
 
-template <typename T>
-s21::orderedList<T> &s21::orderedList<T>::operator=(orderedList &&l) {
+// узлы уходят вместе со своим пулом
+template <typename T, typename Allocator>
+s21::orderedList<T, Allocator> &s21::orderedList<T, Allocator>::operator=(
+    orderedList &&l) {
   if (this != &l) {
-    this->~orderedList();
-    this->count_ = l.count_;
-    head_ = l.head_;
-    tail_ = l.tail_;
-    l.count_ = 0;
-    l.head_ = nullptr;
-    l.tail_ = nullptr;
+    orderedList moved(std::move(l));
+    swap(moved);
   }
   return *this;
 }
 
-template <typename T>
-s21::orderedList<T>::~orderedList() {
+template <typename T, typename Allocator>
+s21::orderedList<T, Allocator>::~orderedList() {
   Node *current = head_;
   while (current != nullptr) {
     Node *temp = current;
     current = current->pNext_;
-    delete temp;
+    destroy_node(temp);
   }
 }
 
-template <typename T>
-T &s21::orderedList<T>::operator[](size_type ind) {
+template <typename T, typename Allocator>
+T &s21::orderedList<T, Allocator>::operator[](size_type ind) {
   // проверка на границы области на совести разработчика
   Node *current = head_;
-  for (size_type i = 0; i < ind && current != nullptr; i++) {
-    current = current->pNext_;
+  size_type at = 0;
+  size_type distance = ind;
+  auto consider = [&](Node *node, size_type index) {
+    size_type to = index < ind ? ind - index : index - ind;
+    if (node != nullptr && to < distance) {
+      current = node;
+      at = index;
+      distance = to;
+    }
+  };
+  consider(tail_, this->count_ - 1);
+  consider(finger_, finger_index_);
+  if (indexed_ && distance > kCheckpointStride) {
+    if (!checkpoints_valid_) {
+      checkpoints_.clear();
+      size_type index = 0;
+      for (Node *node = head_; node != nullptr; node = node->pNext_) {
+        if (index++ % kCheckpointStride == 0) checkpoints_.push_back(node);
+      }
+      checkpoints_valid_ = true;
+    }
+    size_type slot = ind / kCheckpointStride;
+    if (slot < checkpoints_.size()) {
+      consider(checkpoints_[slot], slot * kCheckpointStride);
+    }
   }
+  for (; at < ind; ++at) current = current->pNext_;
+  for (; at > ind; --at) current = current->pPrev_;
+  finger_ = current;
+  finger_index_ = ind;
   return current->data_;
 }
 
-template <typename T>
-void s21::orderedList<T>::swap(orderedList &other) {
+template <typename T, typename Allocator>
+void s21::orderedList<T, Allocator>::swap(orderedList &other) {
   if (this != &other) {
     std::swap(head_, other.head_);
     std::swap(tail_, other.tail_);
     std::swap(this->count_, other.count_);
+    std::swap(alloc_, other.alloc_);
+    forget_positions();
+    other.forget_positions();
   }
 }
 
-template <typename T>
-void s21::orderedList<T>::push_back(const_reference value) {
-  Node *current = new Node(value);
+template <typename T, typename Allocator>
+template <typename... Args>
+T &s21::orderedList<T, Allocator>::emplace_back(Args &&...args) {
+  Node *current = create_node(std::in_place, std::forward<Args>(args)...);
   if (tail_ == nullptr) {
     head_ = current;
     tail_ = current;
@@ -163,5 +254,29 @@ void s21::orderedList<T>::push_back(const_reference value) {
     tail_ = current;
   }
   this->count_++;
+  return current->data_;
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename s21::orderedList<T, Allocator>::Node *
+s21::orderedList<T, Allocator>::create_node(Args &&...args) {
+  Node *node = node_traits::allocate(alloc_, 1);
+  try {
+    node_traits::construct(alloc_, node, std::forward<Args>(args)...);
+  } catch (...) {
+    node_traits::deallocate(alloc_, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <typename T, typename Allocator>
+void s21::orderedList<T, Allocator>::adopt_nodes(orderedList &other) {
+  if constexpr (s21::AdoptsNodes<node_allocator>::value) {
+    alloc_.adopt(other.alloc_);
+  } else {
+    (void)other;
+  }
 }
-#endif  // S21_ORDERED_ORDEREDLIST_H
\ No newline at end of file
+#endif  // S21_ORDERED_ORDEREDLIST_H
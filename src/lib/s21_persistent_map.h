@@ -0,0 +1,99 @@
+#ifndef S21_PERSISTENT_MAP_H
+#define S21_PERSISTENT_MAP_H
+
+#include <utility>  // Для std::pair
+#include <vector>
+
+#include "s21_persistent_tree.h"
+
+namespace s21 {
+
+// Ordered map with O(1) snapshots: copying a persistent_map keeps the old
+// version intact, and every later update allocates only O(log n) nodes.
+template <typename Key, typename Value>
+class persistent_map : public PersistentTree<std::pair<const Key, Value>> {
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<const Key, Value>;
+  using tree_type = PersistentTree<value_type>;
+  using NodeType = typename tree_type::Node;
+  using iterator = typename tree_type::ConstIterator;
+  using const_iterator = typename tree_type::ConstIterator;
+  using reference = const value_type&;
+  using const_reference = const value_type&;
+
+  persistent_map() : tree_type() {}
+  persistent_map(std::initializer_list<std::pair<Key, Value>> const& items) {
+    for (const auto& item : items) insert(item);
+  }
+
+  std::pair<iterator, bool> insert(const std::pair<Key, Value>& value) {
+    return this->insert_tree(value, tree_type::INSERT_NO_DUPLICATE);
+  }
+
+  std::pair<iterator, bool> insert(const Key& key, const Value& obj) {
+    return this->insert_tree(std::make_pair(key, obj),
+                             tree_type::INSERT_NO_DUPLICATE);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const Value& obj) {
+    return this->insert_tree(std::make_pair(key, obj),
+                             tree_type::INSERT_WITH_UPDATE);
+  }
+
+  iterator find(const Key& key) const {
+    const NodeType* current = this->root_;
+    while (current != nullptr) {
+      if (key > current->data.first) {
+        current = current->right;
+      } else if (current->data.first > key) {
+        current = current->left;
+      } else {
+        return this->path_to(current->data);
+      }
+    }
+    return this->end();
+  }
+
+  // Доступ к элементу по ключу
+  const Value& at(const Key& key) const {
+    iterator it = find(key);
+    if (it == this->end()) {
+      throw std::out_of_range("Key not found");
+    }
+    return (*it).second;
+  }
+
+  // Значения неизменяемы, поэтому operator[] доступен только для чтения
+  const Value& operator[](const Key& key) const { return at(key); }
+
+  // Содержит ли map элемент с ключом Key
+  bool contains(const Key& key) const { return find(key) != this->end(); }
+
+  // removes the element with the given key, returns the number removed
+  size_t erase(const Key& key) {
+    iterator it = find(key);
+    if (it == this->end()) return 0;
+    tree_type::erase(it);
+    return 1;
+  }
+  using tree_type::erase;
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    std::vector<std::pair<iterator, bool>> results;
+    (void)(results.push_back(this->insert(std::forward<Args>(args))), ...);
+    return results;
+  }
+
+ protected:
+  virtual bool const_comparator(const value_type& data1,
+                                const value_type& data2) const override {
+    return data1.first > data2.first;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_PERSISTENT_MAP_H
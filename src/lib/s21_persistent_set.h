@@ -0,0 +1,52 @@
+#ifndef S21_PERSISTENT_SET_H
+#define S21_PERSISTENT_SET_H
+
+#include <vector>
+
+#include "s21_persistent_tree.h"
+
+namespace s21 {
+
+// Ordered set with O(1) snapshots, see persistent_map.
+template <typename Key>
+class persistent_set : public PersistentTree<Key> {
+ public:
+  using key_type = Key;
+  using value_type = key_type;
+  using tree_type = PersistentTree<key_type>;
+  using NodeType = typename tree_type::Node;
+  using reference = const value_type&;
+  using const_reference = const value_type&;
+  using iterator = typename tree_type::ConstIterator;
+  using const_iterator = typename tree_type::ConstIterator;
+
+  using tree_type::PersistentTree;
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return this->insert_tree(value, tree_type::INSERT_NO_DUPLICATE);
+  }
+
+  iterator find(const Key& key) const { return this->find_tree(key); }
+
+  bool contains(const Key& key) const { return find(key) != this->end(); }
+
+  // removes the key, returns the number of removed elements
+  size_t erase(const Key& key) {
+    iterator it = find(key);
+    if (it == this->end()) return 0;
+    tree_type::erase(it);
+    return 1;
+  }
+  using tree_type::erase;
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    std::vector<std::pair<iterator, bool>> results;
+    (void)(results.push_back(this->insert(std::forward<Args>(args))), ...);
+    return results;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_PERSISTENT_SET_H
@@ -0,0 +1,413 @@
+#ifndef S21_PERSISTENT_TREE_H
+#define S21_PERSISTENT_TREE_H
+
+#include <algorithm>  // for std::max
+#include <utility>    // Для std::pair
+#include <vector>
+
+#include "s21_container.h"
+
+namespace s21 {
+
+// Immutable AVL tree with structural sharing. Nodes are never modified after
+// construction: every update copies only the nodes on the path from the root
+// to the changed position (O(log n) allocations) and shares the rest with the
+// previous version. Copying a tree is O(1) and gives an independent snapshot.
+template <typename DataType>
+class PersistentTree : public Container<DataType> {
+ public:
+  using size_type = std::size_t;
+  struct Node;
+  class ConstIterator;
+
+  PersistentTree() : root_(nullptr) {}
+  PersistentTree(std::initializer_list<DataType> const& items);
+  PersistentTree(const PersistentTree& t);
+  PersistentTree(PersistentTree&& t);
+  virtual ~PersistentTree() { release(root_); }
+
+  PersistentTree& operator=(const PersistentTree& other);
+  PersistentTree& operator=(PersistentTree&& other);
+
+  ConstIterator begin() const;
+  ConstIterator end() const { return ConstIterator(this); }
+
+  // erases the element with the key of *pos; pos may come from another
+  // version of the tree, nothing is erased if this one lacks the key
+  void erase(ConstIterator pos);
+  void clear();
+  void swap(PersistentTree& other);
+
+  // number of versions (trees or parent nodes) sharing the root node
+  size_type use_count() const { return root_ ? root_->refs : 0; }
+
+ protected:
+  enum InsertMode {
+    INSERT_NO_DUPLICATE = 1,  // Insert without duplicates and without updating
+    INSERT_WITH_UPDATE = 2    // Inserting and updating an existing element
+  };
+
+  std::pair<ConstIterator, bool> insert_tree(const DataType& data, int mode);
+  ConstIterator find_tree(const DataType& data) const;
+  // iterator pointing to the node holding the value equal to data
+  ConstIterator path_to(const DataType& data) const;
+
+  virtual bool const_comparator(const DataType& data1,
+                                const DataType& data2) const {
+    return data1 > data2;
+  }
+
+  static Node* retain(Node* node) {
+    if (node) ++node->refs;
+    return node;
+  }
+  static void release(Node* node);
+  static int height(const Node* node) { return node ? node->height : 0; }
+
+  // constructs a node taking ownership of the references left and right
+  static Node* make_node(const DataType& data, Node* left, Node* right) {
+    return new Node(data, left, right);
+  }
+  static Node* make_balanced(const DataType& data, Node* left, Node* right);
+
+  Node* insert_node(Node* node, const DataType& data);
+  Node* erase_node(Node* node, const DataType& data);
+  static Node* erase_min(Node* node, const Node*& min);
+
+  Node* root_ = nullptr;
+};
+
+// ---------------------------------- Node ---------------------------------
+template <typename DataType>
+struct PersistentTree<DataType>::Node {
+  const DataType data;
+  Node* const left;
+  Node* const right;
+  const int height;
+  // owners: tree versions whose root is this node plus parent nodes
+  size_type refs = 1;
+
+  Node(const DataType& data, Node* l, Node* r)
+      : data(data),
+        left(l),
+        right(r),
+        height(1 + std::max(PersistentTree::height(l),
+                            PersistentTree::height(r))) {}
+};
+
+// ---------------------------------- Iterator ---------------------------------
+// Nodes are shared between versions and have no parent links, so the iterator
+// keeps the path from the root to the current node.
+template <typename DataType>
+class PersistentTree<DataType>::ConstIterator {
+ public:
+  explicit ConstIterator(const PersistentTree<DataType>* tree) : tree_(tree) {}
+  ConstIterator(const ConstIterator& other) = default;
+  ConstIterator& operator=(const ConstIterator& other) = default;
+
+  const DataType& operator*() const { return path_.back()->data; }
+  const DataType* operator->() const { return &(path_.back()->data); }
+  ConstIterator& operator++();
+  ConstIterator operator++(int);
+  ConstIterator& operator--();
+  ConstIterator operator--(int);
+
+  bool operator==(const ConstIterator& other) const {
+    return current() == other.current();
+  }
+  bool operator!=(const ConstIterator& other) const {
+    return current() != other.current();
+  }
+
+ protected:
+  friend class PersistentTree<DataType>;
+
+  const Node* current() const { return path_.empty() ? nullptr : path_.back(); }
+  void descend_left(const Node* node) {
+    for (; node != nullptr; node = node->left) path_.push_back(node);
+  }
+  void descend_right(const Node* node) {
+    for (; node != nullptr; node = node->right) path_.push_back(node);
+  }
+
+  std::vector<const Node*> path_;
+  const PersistentTree<DataType>* tree_;
+};
+
+template <typename DataType>
+typename PersistentTree<DataType>::ConstIterator&
+PersistentTree<DataType>::ConstIterator::operator++() {
+  if (path_.empty()) {
+    descend_left(tree_->root_);
+  } else if (path_.back()->right != nullptr) {
+    descend_left(path_.back()->right);
+  } else {
+    const Node* child = path_.back();
+    path_.pop_back();
+    while (!path_.empty() && path_.back()->right == child) {
+      child = path_.back();
+      path_.pop_back();
+    }
+  }
+  return *this;
+}
+
+template <typename DataType>
+typename PersistentTree<DataType>::ConstIterator
+PersistentTree<DataType>::ConstIterator::operator++(int) {
+  ConstIterator tmp(*this);
+  ++(*this);
+  return tmp;
+}
+
+template <typename DataType>
+typename PersistentTree<DataType>::ConstIterator&
+PersistentTree<DataType>::ConstIterator::operator--() {
+  if (path_.empty()) {
+    descend_right(tree_->root_);
+  } else if (path_.back()->left != nullptr) {
+    descend_right(path_.back()->left);
+  } else {
+    const Node* child = path_.back();
+    path_.pop_back();
+    while (!path_.empty() && path_.back()->left == child) {
+      child = path_.back();
+      path_.pop_back();
+    }
+  }
+  return *this;
+}
+
+template <typename DataType>
+typename PersistentTree<DataType>::ConstIterator
+PersistentTree<DataType>::ConstIterator::operator--(int) {
+  ConstIterator tmp(*this);
+  --(*this);
+  return tmp;
+}
+
+// -------------------- constructors and destructors ------------------------
+template <typename DataType>
+PersistentTree<DataType>::PersistentTree(
+    std::initializer_list<DataType> const& items)
+    : PersistentTree() {
+  for (const auto& item : items) {
+    insert_tree(item, INSERT_NO_DUPLICATE);
+  }
+}
+
+template <typename DataType>
+PersistentTree<DataType>::PersistentTree(const PersistentTree<DataType>& t)
+    : root_(retain(t.root_)) {
+  this->count_ = t.count_;
+}
+
+template <typename DataType>
+PersistentTree<DataType>::PersistentTree(PersistentTree<DataType>&& t)
+    : PersistentTree() {
+  swap(t);
+}
+
+template <typename DataType>
+PersistentTree<DataType>& PersistentTree<DataType>::operator=(
+    const PersistentTree<DataType>& other) {
+  if (this != &other) {
+    Node* old = root_;
+    root_ = retain(other.root_);
+    this->count_ = other.count_;
+    release(old);
+  }
+  return *this;
+}
+
+template <typename DataType>
+PersistentTree<DataType>& PersistentTree<DataType>::operator=(
+    PersistentTree<DataType>&& other) {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+// ----------------------------  methods  ------------------------------
+
+template <typename DataType>
+typename PersistentTree<DataType>::ConstIterator
+PersistentTree<DataType>::begin() const {
+  ConstIterator it(this);
+  it.descend_left(root_);
+  return it;
+}
+
+template <typename DataType>
+void PersistentTree<DataType>::release(Node* node) {
+  // Only the spine of nodes that drop to zero is walked, so the depth of this
+  // loop is bounded by the height of the tree.
+  while (node != nullptr && --node->refs == 0) {
+    Node* right = node->right;
+    release(node->left);
+    delete node;
+    node = right;
+  }
+}
+
+template <typename DataType>
+typename PersistentTree<DataType>::Node*
+PersistentTree<DataType>::make_balanced(const DataType& data, Node* left,
+                                        Node* right) {
+  Node* result = nullptr;
+  if (height(left) > height(right) + 1) {
+    if (height(left->left) >= height(left->right)) {
+      result = make_node(left->data, retain(left->left),
+                         make_node(data, retain(left->right), right));
+    } else {
+      Node* lr = left->right;
+      result = make_node(lr->data,
+                         make_node(left->data, retain(left->left),
+                                   retain(lr->left)),
+                         make_node(data, retain(lr->right), right));
+    }
+    release(left);
+  } else if (height(right) > height(left) + 1) {
+    if (height(right->right) >= height(right->left)) {
+      result = make_node(right->data, make_node(data, left, retain(right->left)),
+                         retain(right->right));
+    } else {
+      Node* rl = right->left;
+      result = make_node(rl->data, make_node(data, left, retain(rl->left)),
+                         make_node(right->data, retain(rl->right),
+                                   retain(right->right)));
+    }
+    release(right);
+  } else {
+    result = make_node(data, left, right);
+  }
+  return result;
+}
+
+template <typename DataType>
+typename PersistentTree<DataType>::Node*
+PersistentTree<DataType>::insert_node(Node* node, const DataType& data) {
+  Node* result = nullptr;
+  if (node == nullptr) {
+    result = make_node(data, nullptr, nullptr);
+  } else if (const_comparator(data, node->data)) {
+    result = make_balanced(node->data, retain(node->left),
+                           insert_node(node->right, data));
+  } else if (const_comparator(node->data, data)) {
+    result = make_balanced(node->data, insert_node(node->left, data),
+                           retain(node->right));
+  } else {  // Элементы равны - заменяем значение
+    result = make_node(data, retain(node->left), retain(node->right));
+  }
+  return result;
+}
+
+template <typename DataType>
+typename PersistentTree<DataType>::Node* PersistentTree<DataType>::erase_min(
+    Node* node, const Node*& min) {
+  if (node->left == nullptr) {
+    min = node;
+    return retain(node->right);
+  }
+  return make_balanced(node->data, erase_min(node->left, min),
+                       retain(node->right));
+}
+
+template <typename DataType>
+typename PersistentTree<DataType>::Node* PersistentTree<DataType>::erase_node(
+    Node* node, const DataType& data) {
+  Node* result = nullptr;
+  if (const_comparator(data, node->data)) {
+    result = make_balanced(node->data, retain(node->left),
+                           erase_node(node->right, data));
+  } else if (const_comparator(node->data, data)) {
+    result = make_balanced(node->data, erase_node(node->left, data),
+                           retain(node->right));
+  } else if (node->left == nullptr) {
+    result = retain(node->right);
+  } else if (node->right == nullptr) {
+    result = retain(node->left);
+  } else {
+    // min stays alive: the old version still owns it until root_ is replaced
+    const Node* min = nullptr;
+    Node* right = erase_min(node->right, min);
+    result = make_balanced(min->data, retain(node->left), right);
+  }
+  return result;
+}
+
+template <typename DataType>
+std::pair<typename PersistentTree<DataType>::ConstIterator, bool>
+PersistentTree<DataType>::insert_tree(const DataType& data, int mode) {
+  bool inserted = find_tree(data) == end();
+  if (inserted || mode == INSERT_WITH_UPDATE) {
+    Node* old = root_;
+    root_ = insert_node(root_, data);
+    release(old);
+    if (inserted) this->count_++;
+  }
+  return {path_to(data), inserted};
+}
+
+template <typename DataType>
+typename PersistentTree<DataType>::ConstIterator
+PersistentTree<DataType>::find_tree(const DataType& data) const {
+  const Node* current = root_;
+  while (current != nullptr) {
+    if (const_comparator(data, current->data)) {
+      current = current->right;
+    } else if (const_comparator(current->data, data)) {
+      current = current->left;
+    } else {
+      return path_to(data);
+    }
+  }
+  return end();
+}
+
+template <typename DataType>
+typename PersistentTree<DataType>::ConstIterator
+PersistentTree<DataType>::path_to(const DataType& data) const {
+  ConstIterator it(this);
+  const Node* current = root_;
+  while (current != nullptr) {
+    it.path_.push_back(current);
+    if (const_comparator(data, current->data)) {
+      current = current->right;
+    } else if (const_comparator(current->data, data)) {
+      current = current->left;
+    } else {
+      break;
+    }
+  }
+  if (current == nullptr) it.path_.clear();
+  return it;
+}
+
+template <typename DataType>
+void PersistentTree<DataType>::erase(ConstIterator pos) {
+  if (pos == end() || find_tree(*pos) == end()) return;
+  // pos may point into this version, keep the key alive while rebuilding
+  Node* old = root_;
+  root_ = erase_node(root_, *pos);
+  release(old);
+  --this->count_;
+}
+
+template <typename DataType>
+void PersistentTree<DataType>::clear() {
+  release(root_);
+  root_ = nullptr;
+  this->count_ = 0;
+}
+
+template <typename DataType>
+void PersistentTree<DataType>::swap(PersistentTree<DataType>& other) {
+  std::swap(other.root_, root_);
+  std::swap(other.count_, this->count_);
+}
+
+}  // namespace s21
+#endif  // S21_PERSISTENT_TREE_H
@@ -4,41 +4,43 @@
 #include "s21_ordered_list.h"
 
 namespace s21 {
-template <typename T>
-class queue : public orderedList<T> {
+template <typename T, typename Allocator = NodePool<T>>
+class queue : public orderedList<T, Allocator> {
  public:
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
   // default constructor, creates empty queue
-  queue() : orderedList<value_type>(){};
+  queue() : orderedList<value_type, Allocator>(){};
   // initializer list constructor, creates queue initizialized using
   // std::initializer_list
   queue(std::initializer_list<value_type> const &items)
-      : orderedList<value_type>(items){};
+      : orderedList<value_type, Allocator>(items){};
   // copy constructor
-  queue(const queue &q) : orderedList<value_type>(q){};
+  queue(const queue &q) : orderedList<value_type, Allocator>(q){};
   // move constructor
-  queue(queue &&q) : orderedList<value_type>(std::move(q)){};
+  queue(queue &&q) : orderedList<value_type, Allocator>(std::move(q)){};
   // assignment operator overload for moving object
   queue &operator=(queue &&q) {
     return static_cast<queue &>(
-        orderedList<value_type>::operator=(std::move(q)));
+        orderedList<value_type, Allocator>::operator=(std::move(q)));
   }
   // destructor
   ~queue();
   // access the first element
-  const_reference front() {
-    return static_cast<const_reference>(orderedList<value_type>::front());
-  }
+  reference front() { return orderedList<value_type, Allocator>::front(); }
   // access the last element
-  const_reference back() {
-    return static_cast<const_reference>(orderedList<value_type>::back());
-  }
+  reference back() { return orderedList<value_type, Allocator>::back(); }
 
   // inserts element at the end
   void push(const_reference value) { this->push_back(value); }
+  void push(value_type &&value) { this->push_back(std::move(value)); }
+  // constructs the element in its node from args
+  template <typename... Args>
+  reference emplace(Args &&...args) {
+    return this->emplace_back(std::forward<Args>(args)...);
+  }
   // removes the first element
   void pop();
 
@@ -49,16 +51,17 @@ class queue : public orderedList<T> {
 };
 }  // namespace s21
 
-template <typename T>
-s21::queue<T>::~queue() {
+template <typename T, typename Allocator>
+s21::queue<T, Allocator>::~queue() {
   while (this->head_ != nullptr) pop();
   this->tail_ = nullptr;
 }
 
-template <typename T>
-void s21::queue<T>::pop() {
+template <typename T, typename Allocator>
+void s21::queue<T, Allocator>::pop() {
   if (this->head_ != nullptr) {
     auto *temp = this->head_;
+    this->forget_positions();
     // проверка на очередь из 1 элемента
     if (this->head_->pNext_ != nullptr) {
       this->head_ = this->head_->pNext_;
@@ -67,17 +70,15 @@ void s21::queue<T>::pop() {
       this->head_ = nullptr;
       this->tail_ = nullptr;
     }
-    delete temp;
+    this->destroy_node(temp);
     this->count_--;
   }
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void s21::queue<T>::insert_many_back(Args &&...args) {
-  for (auto &arg : {args...}) {
-    push(arg);
-  }
+void s21::queue<T, Allocator>::insert_many_back(Args &&...args) {
+  (this->emplace_back(std::forward<Args>(args)), ...);
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,844 @@
+#ifndef S21_RADIX_MAP_H
+#define S21_RADIX_MAP_H
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>  // Для std::pair
+#include <vector>
+
+#include "s21_container.h"
+
+namespace s21 {
+
+// Byte string of a key whose lexicographic order matches the key order.
+struct RadixKey {
+  const unsigned char* data() const { return external ? external : buf; }
+  const unsigned char* external = nullptr;
+  size_t size = 0;
+  unsigned char buf[sizeof(uint64_t)];
+};
+
+template <typename Key, typename Enable = void>
+struct RadixKeyTraits;
+
+// Integers are stored big-endian with the sign bit flipped.
+template <typename Key>
+struct RadixKeyTraits<Key, std::enable_if_t<std::is_integral<Key>::value>> {
+  static void encode(const Key& key, RadixKey& out) {
+    using Unsigned = std::make_unsigned_t<Key>;
+    Unsigned value = static_cast<Unsigned>(key);
+    if (std::is_signed<Key>::value) {
+      value ^= Unsigned{1} << (sizeof(Key) * 8 - 1);
+    }
+    for (size_t i = 0; i < sizeof(Key); ++i) {
+      out.buf[sizeof(Key) - 1 - i] =
+          static_cast<unsigned char>(value >> (8 * i));
+    }
+    out.size = sizeof(Key);
+  }
+};
+
+// Strings are used as is, without a copy.
+template <>
+struct RadixKeyTraits<std::string> {
+  static void encode(const std::string& key, RadixKey& out) {
+    out.external = reinterpret_cast<const unsigned char*>(key.data());
+    out.size = key.size();
+  }
+};
+
+// Adaptive radix tree. Inner nodes grow and shrink between 4, 16, 48 and 256
+// children, single-child chains are collapsed into a prefix stored in the
+// node (only the first kMaxPrefix bytes are kept, the rest is checked against
+// the full key kept in every leaf). A key that ends inside the tree is kept
+// in the leaf slot of the inner node where it ends, so keys may be prefixes
+// of each other. Iteration visits keys in ascending order, like s21::map.
+template <typename Key, typename Value>
+class radix_map : public Container<std::pair<Key, Value>> {
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<Key, Value>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = size_t;
+  class Iterator;
+  using iterator = Iterator;
+
+  radix_map() : root_(nullptr) {}
+  radix_map(std::initializer_list<value_type> const& items) : radix_map() {
+    for (const auto& item : items) insert(item);
+  }
+  radix_map(const radix_map& other) : radix_map() {
+    for (auto it = other.cbegin(); it != other.cend(); ++it) insert(*it);
+  }
+  radix_map(radix_map&& other) : radix_map() { swap(other); }
+  radix_map& operator=(radix_map&& other) {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+  ~radix_map() { clear(); }
+
+  iterator begin() const;
+  iterator end() const { return Iterator(); }
+  iterator cbegin() const { return begin(); }
+  iterator cend() const { return end(); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return insert_leaf(value, false);
+  }
+  std::pair<iterator, bool> insert(const Key& key, const Value& obj) {
+    return insert_leaf(value_type(key, obj), false);
+  }
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const Value& obj) {
+    return insert_leaf(value_type(key, obj), true);
+  }
+
+  iterator find(const Key& key) const;
+  bool contains(const Key& key) const { return find_leaf(key) != nullptr; }
+
+  // Доступ к элементу по ключу
+  Value& at(const Key& key) {
+    Leaf* leaf = find_leaf(key);
+    if (leaf == nullptr) {
+      throw std::out_of_range("Key not found");
+    }
+    return leaf->data.second;
+  }
+
+  // Доступ или вставка элемента по заданному ключу
+  Value& operator[](const Key& key) {
+    Leaf* leaf = find_leaf(key);
+    if (leaf == nullptr) leaf = insert(key, Value{}).first.leaf_;
+    return leaf->data.second;
+  }
+
+  // removes the element with the given key, returns the number removed
+  size_type erase(const Key& key);
+  void erase(iterator pos) {
+    if (pos != end()) erase(pos->first);
+  }
+
+  void clear() {
+    destroy(root_);
+    root_ = nullptr;
+    this->count_ = 0;
+  }
+
+  void swap(radix_map& other) {
+    std::swap(root_, other.root_);
+    std::swap(this->count_, other.count_);
+  }
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    std::vector<std::pair<iterator, bool>> results;
+    (void)(results.push_back(this->insert(std::forward<Args>(args))), ...);
+    return results;
+  }
+
+ protected:
+  enum NodeType : uint8_t { LEAF, NODE4, NODE16, NODE48, NODE256 };
+  static constexpr uint32_t kMaxPrefix = 8;
+
+  struct NodeBase {
+    explicit NodeBase(NodeType t) : type(t) {}
+    NodeType type;
+  };
+  struct Leaf : NodeBase {
+    explicit Leaf(const value_type& d) : NodeBase(LEAF), data(d) {}
+    value_type data;
+  };
+  struct Inner : NodeBase {
+    explicit Inner(NodeType t) : NodeBase(t) {}
+    uint16_t num_children = 0;
+    uint32_t prefix_len = 0;
+    unsigned char prefix[kMaxPrefix] = {};
+    // the key that ends at this node
+    Leaf* leaf = nullptr;
+  };
+  struct Node4 : Inner {
+    Node4() : Inner(NODE4) {}
+    unsigned char keys[4] = {};
+    NodeBase* children[4] = {};
+  };
+  struct Node16 : Inner {
+    Node16() : Inner(NODE16) {}
+    unsigned char keys[16] = {};
+    NodeBase* children[16] = {};
+  };
+  struct Node48 : Inner {
+    Node48() : Inner(NODE48) {}
+    // slot + 1 of the child for every byte, 0 if there is none
+    unsigned char index[256] = {};
+    NodeBase* children[48] = {};
+  };
+  struct Node256 : Inner {
+    Node256() : Inner(NODE256) {}
+    NodeBase* children[256] = {};
+  };
+
+  static RadixKey encode(const Key& key) {
+    RadixKey bytes;
+    RadixKeyTraits<Key>::encode(key, bytes);
+    return bytes;
+  }
+  static bool leaf_matches(const Leaf* leaf, const Key& key) {
+    return !(leaf->data.first > key) && !(key > leaf->data.first);
+  }
+
+  // frees the node and everything below it
+  static void destroy(NodeBase* node);
+  // frees a single inner node, its children and leaf are kept
+  static void free_node(Inner* node);
+  static Leaf* min_leaf(NodeBase* node);
+  // slot of the child for byte, nullptr if there is none
+  static NodeBase** find_child(Inner* node, unsigned char byte);
+  // position of the first child at position >= pos, -1 if there is none;
+  // positions are indexes for NODE4/NODE16 and bytes for NODE48/NODE256
+  static int next_child(const Inner* node, int pos, NodeBase** child);
+  static int child_position(const Inner* node, unsigned char byte);
+  static unsigned char branch_byte(const Inner* node, int pos);
+  static void add_child(NodeBase*& ref, unsigned char byte, NodeBase* child);
+  static void remove_child(NodeBase*& ref, unsigned char byte);
+  static void copy_header(Inner* to, const Inner* from);
+  // length of the common part of the node prefix and the key after depth
+  static uint32_t prefix_mismatch(Inner* node, const RadixKey& key,
+                                  size_t depth);
+
+  std::pair<iterator, bool> insert_leaf(const value_type& value, bool update);
+  Leaf* find_leaf(const Key& key) const;
+  bool erase_node(NodeBase*& ref, const Key& key, const RadixKey& bytes,
+                  size_t depth);
+
+  NodeBase* root_;
+};
+
+// ---------------------------------- Iterator ---------------------------------
+// In-order walk over the tree: a stack of inner nodes with the position of
+// the next child to visit, -1 while the leaf slot has not been visited yet.
+template <typename Key, typename Value>
+class radix_map<Key, Value>::Iterator {
+ public:
+  Iterator() : leaf_(nullptr) {}
+  value_type& operator*() const { return leaf_->data; }
+  value_type* operator->() const { return &leaf_->data; }
+  Iterator& operator++() {
+    advance();
+    return *this;
+  }
+  Iterator operator++(int) {
+    Iterator tmp(*this);
+    advance();
+    return tmp;
+  }
+  bool operator==(const Iterator& other) const { return leaf_ == other.leaf_; }
+  bool operator!=(const Iterator& other) const { return leaf_ != other.leaf_; }
+
+ protected:
+  friend class radix_map<Key, Value>;
+  struct Frame {
+    Inner* node;
+    int pos;
+  };
+
+  // moves to the next leaf in key order
+  void advance() {
+    leaf_ = nullptr;
+    while (leaf_ == nullptr && !stack_.empty()) {
+      Frame& frame = stack_.back();
+      if (frame.pos < 0) {
+        frame.pos = 0;
+        leaf_ = frame.node->leaf;
+        continue;
+      }
+      NodeBase* child = nullptr;
+      int pos = next_child(frame.node, frame.pos, &child);
+      if (pos < 0) {
+        stack_.pop_back();
+      } else {
+        frame.pos = pos + 1;
+        if (child->type == LEAF) {
+          leaf_ = static_cast<Leaf*>(child);
+        } else {
+          stack_.push_back({static_cast<Inner*>(child), -1});
+        }
+      }
+    }
+  }
+
+  Leaf* leaf_;
+  std::vector<Frame> stack_;
+};
+
+// ---------------------------------- methods ---------------------------------
+
+template <typename Key, typename Value>
+void radix_map<Key, Value>::destroy(NodeBase* node) {
+  if (node == nullptr) return;
+  if (node->type == LEAF) {
+    delete static_cast<Leaf*>(node);
+    return;
+  }
+  Inner* inner = static_cast<Inner*>(node);
+  NodeBase* child = nullptr;
+  for (int pos = next_child(inner, 0, &child); pos >= 0;
+       pos = next_child(inner, pos + 1, &child)) {
+    destroy(child);
+  }
+  delete inner->leaf;
+  free_node(inner);
+}
+
+template <typename Key, typename Value>
+void radix_map<Key, Value>::free_node(Inner* node) {
+  switch (node->type) {
+    case NODE4:
+      delete static_cast<Node4*>(node);
+      break;
+    case NODE16:
+      delete static_cast<Node16*>(node);
+      break;
+    case NODE48:
+      delete static_cast<Node48*>(node);
+      break;
+    default:
+      delete static_cast<Node256*>(node);
+  }
+}
+
+template <typename Key, typename Value>
+unsigned char radix_map<Key, Value>::branch_byte(const Inner* node, int pos) {
+  if (node->type == NODE4) return static_cast<const Node4*>(node)->keys[pos];
+  if (node->type == NODE16) return static_cast<const Node16*>(node)->keys[pos];
+  return static_cast<unsigned char>(pos);
+}
+
+template <typename Key, typename Value>
+typename radix_map<Key, Value>::Leaf* radix_map<Key, Value>::min_leaf(
+    NodeBase* node) {
+  while (node != nullptr && node->type != LEAF) {
+    Inner* inner = static_cast<Inner*>(node);
+    if (inner->leaf != nullptr) return inner->leaf;
+    next_child(inner, 0, &node);
+  }
+  return static_cast<Leaf*>(node);
+}
+
+template <typename Key, typename Value>
+typename radix_map<Key, Value>::NodeBase** radix_map<Key, Value>::find_child(
+    Inner* node, unsigned char byte) {
+  switch (node->type) {
+    case NODE4: {
+      Node4* n = static_cast<Node4*>(node);
+      for (int i = 0; i < n->num_children; ++i) {
+        if (n->keys[i] == byte) return &n->children[i];
+      }
+      return nullptr;
+    }
+    case NODE16: {
+      Node16* n = static_cast<Node16*>(node);
+#if defined(__SSE2__)
+      // compare all 16 keys at once
+      __m128i cmp = _mm_cmpeq_epi8(
+          _mm_set1_epi8(static_cast<char>(byte)),
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(n->keys)));
+      int mask = _mm_movemask_epi8(cmp) & ((1 << n->num_children) - 1);
+      return mask ? &n->children[__builtin_ctz(mask)] : nullptr;
+#else
+      for (int i = 0; i < n->num_children; ++i) {
+        if (n->keys[i] == byte) return &n->children[i];
+      }
+      return nullptr;
+#endif
+    }
+    case NODE48: {
+      Node48* n = static_cast<Node48*>(node);
+      return n->index[byte] ? &n->children[n->index[byte] - 1] : nullptr;
+    }
+    default: {
+      Node256* n = static_cast<Node256*>(node);
+      return n->children[byte] ? &n->children[byte] : nullptr;
+    }
+  }
+}
+
+template <typename Key, typename Value>
+int radix_map<Key, Value>::next_child(const Inner* node, int pos,
+                                      NodeBase** child) {
+  switch (node->type) {
+    case NODE4: {
+      const Node4* n = static_cast<const Node4*>(node);
+      if (pos >= n->num_children) return -1;
+      *child = n->children[pos];
+      return pos;
+    }
+    case NODE16: {
+      const Node16* n = static_cast<const Node16*>(node);
+      if (pos >= n->num_children) return -1;
+      *child = n->children[pos];
+      return pos;
+    }
+    case NODE48: {
+      const Node48* n = static_cast<const Node48*>(node);
+      for (; pos < 256; ++pos) {
+        if (n->index[pos]) {
+          *child = n->children[n->index[pos] - 1];
+          return pos;
+        }
+      }
+      return -1;
+    }
+    default: {
+      const Node256* n = static_cast<const Node256*>(node);
+      for (; pos < 256; ++pos) {
+        if (n->children[pos]) {
+          *child = n->children[pos];
+          return pos;
+        }
+      }
+      return -1;
+    }
+  }
+}
+
+template <typename Key, typename Value>
+int radix_map<Key, Value>::child_position(const Inner* node,
+                                          unsigned char byte) {
+  if (node->type == NODE4) {
+    const Node4* n = static_cast<const Node4*>(node);
+    for (int i = 0; i < n->num_children; ++i) {
+      if (n->keys[i] == byte) return i;
+    }
+  } else if (node->type == NODE16) {
+    const Node16* n = static_cast<const Node16*>(node);
+    for (int i = 0; i < n->num_children; ++i) {
+      if (n->keys[i] == byte) return i;
+    }
+  } else {
+    return byte;
+  }
+  return -1;
+}
+
+template <typename Key, typename Value>
+void radix_map<Key, Value>::copy_header(Inner* to, const Inner* from) {
+  to->num_children = from->num_children;
+  to->prefix_len = from->prefix_len;
+  std::memcpy(to->prefix, from->prefix, kMaxPrefix);
+  to->leaf = from->leaf;
+}
+
+// keys of NODE4 and NODE16 are kept sorted for ordered iteration
+template <typename Key, typename Value>
+void radix_map<Key, Value>::add_child(NodeBase*& ref, unsigned char byte,
+                                      NodeBase* child) {
+  Inner* node = static_cast<Inner*>(ref);
+  if (node->type == NODE4 && node->num_children == 4) {
+    Node4* old = static_cast<Node4*>(node);
+    Node16* grown = new Node16();
+    copy_header(grown, old);
+    std::memcpy(grown->keys, old->keys, 4);
+    std::memcpy(grown->children, old->children, 4 * sizeof(NodeBase*));
+    delete old;
+    ref = node = grown;
+  } else if (node->type == NODE16 && node->num_children == 16) {
+    Node16* old = static_cast<Node16*>(node);
+    Node48* grown = new Node48();
+    copy_header(grown, old);
+    for (int i = 0; i < 16; ++i) {
+      grown->children[i] = old->children[i];
+      grown->index[old->keys[i]] = i + 1;
+    }
+    delete old;
+    ref = node = grown;
+  } else if (node->type == NODE48 && node->num_children == 48) {
+    Node48* old = static_cast<Node48*>(node);
+    Node256* grown = new Node256();
+    copy_header(grown, old);
+    for (int b = 0; b < 256; ++b) {
+      if (old->index[b]) grown->children[b] = old->children[old->index[b] - 1];
+    }
+    delete old;
+    ref = node = grown;
+  }
+
+  if (node->type == NODE4 || node->type == NODE16) {
+    unsigned char* keys = node->type == NODE4
+                              ? static_cast<Node4*>(node)->keys
+                              : static_cast<Node16*>(node)->keys;
+    NodeBase** children = node->type == NODE4
+                              ? static_cast<Node4*>(node)->children
+                              : static_cast<Node16*>(node)->children;
+    int pos = node->num_children;
+    while (pos > 0 && keys[pos - 1] > byte) {
+      keys[pos] = keys[pos - 1];
+      children[pos] = children[pos - 1];
+      --pos;
+    }
+    keys[pos] = byte;
+    children[pos] = child;
+  } else if (node->type == NODE48) {
+    Node48* n = static_cast<Node48*>(node);
+    int slot = 0;
+    while (n->children[slot] != nullptr) ++slot;
+    n->children[slot] = child;
+    n->index[byte] = slot + 1;
+  } else {
+    static_cast<Node256*>(node)->children[byte] = child;
+  }
+  ++node->num_children;
+}
+
+template <typename Key, typename Value>
+void radix_map<Key, Value>::remove_child(NodeBase*& ref, unsigned char byte) {
+  Inner* node = static_cast<Inner*>(ref);
+  if (node->type == NODE4 || node->type == NODE16) {
+    unsigned char* keys = node->type == NODE4
+                              ? static_cast<Node4*>(node)->keys
+                              : static_cast<Node16*>(node)->keys;
+    NodeBase** children = node->type == NODE4
+                              ? static_cast<Node4*>(node)->children
+                              : static_cast<Node16*>(node)->children;
+    int pos = child_position(node, byte);
+    for (int i = pos; i + 1 < node->num_children; ++i) {
+      keys[i] = keys[i + 1];
+      children[i] = children[i + 1];
+    }
+    children[node->num_children - 1] = nullptr;
+  } else if (node->type == NODE48) {
+    Node48* n = static_cast<Node48*>(node);
+    n->children[n->index[byte] - 1] = nullptr;
+    n->index[byte] = 0;
+  } else {
+    static_cast<Node256*>(node)->children[byte] = nullptr;
+  }
+  --node->num_children;
+
+  // shrink with some hysteresis so that a node does not flip between sizes
+  if (node->type == NODE256 && node->num_children <= 37) {
+    Node256* old = static_cast<Node256*>(node);
+    Node48* shrunk = new Node48();
+    copy_header(shrunk, old);
+    int slot = 0;
+    for (int b = 0; b < 256; ++b) {
+      if (old->children[b]) {
+        shrunk->children[slot] = old->children[b];
+        shrunk->index[b] = ++slot;
+      }
+    }
+    delete old;
+    ref = shrunk;
+  } else if (node->type == NODE48 && node->num_children <= 12) {
+    Node48* old = static_cast<Node48*>(node);
+    Node16* shrunk = new Node16();
+    copy_header(shrunk, old);
+    int pos = 0;
+    for (int b = 0; b < 256; ++b) {
+      if (old->index[b]) {
+        shrunk->keys[pos] = static_cast<unsigned char>(b);
+        shrunk->children[pos++] = old->children[old->index[b] - 1];
+      }
+    }
+    delete old;
+    ref = shrunk;
+  } else if (node->type == NODE16 && node->num_children <= 3) {
+    Node16* old = static_cast<Node16*>(node);
+    Node4* shrunk = new Node4();
+    copy_header(shrunk, old);
+    std::memcpy(shrunk->keys, old->keys, old->num_children);
+    std::memcpy(shrunk->children, old->children,
+                old->num_children * sizeof(NodeBase*));
+    delete old;
+    ref = shrunk;
+  }
+}
+
+template <typename Key, typename Value>
+uint32_t radix_map<Key, Value>::prefix_mismatch(Inner* node,
+                                                const RadixKey& key,
+                                                size_t depth) {
+  const unsigned char* bytes = key.data();
+  uint32_t stored = std::min(node->prefix_len, kMaxPrefix);
+  uint32_t i = 0;
+  for (; i < stored; ++i) {
+    if (depth + i >= key.size || node->prefix[i] != bytes[depth + i]) return i;
+  }
+  if (node->prefix_len > kMaxPrefix) {
+    // the rest of the prefix is only known from the keys below the node
+    RadixKey full = encode(min_leaf(node)->data.first);
+    for (; i < node->prefix_len; ++i) {
+      if (depth + i >= key.size || full.data()[depth + i] != bytes[depth + i]) {
+        return i;
+      }
+    }
+  }
+  return i;
+}
+
+template <typename Key, typename Value>
+typename radix_map<Key, Value>::Leaf* radix_map<Key, Value>::find_leaf(
+    const Key& key) const {
+  RadixKey bytes = encode(key);
+  const unsigned char* data = bytes.data();
+  NodeBase* node = root_;
+  size_t depth = 0;
+  while (node != nullptr && node->type != LEAF) {
+    Inner* inner = static_cast<Inner*>(node);
+    // optimistic: bytes past kMaxPrefix are verified against the leaf
+    uint32_t stored = std::min(inner->prefix_len, kMaxPrefix);
+    if (depth + inner->prefix_len > bytes.size ||
+        std::memcmp(inner->prefix, data + depth, stored) != 0) {
+      return nullptr;
+    }
+    depth += inner->prefix_len;
+    if (depth == bytes.size) {
+      node = inner->leaf;
+    } else {
+      NodeBase** child = find_child(inner, data[depth]);
+      node = child ? *child : nullptr;
+      ++depth;
+    }
+  }
+  Leaf* leaf = static_cast<Leaf*>(node);
+  return (leaf != nullptr && leaf_matches(leaf, key)) ? leaf : nullptr;
+}
+
+template <typename Key, typename Value>
+typename radix_map<Key, Value>::iterator radix_map<Key, Value>::begin() const {
+  Iterator it;
+  if (root_ != nullptr && root_->type == LEAF) {
+    it.leaf_ = static_cast<Leaf*>(root_);
+  } else if (root_ != nullptr) {
+    it.stack_.push_back({static_cast<Inner*>(root_), -1});
+    it.advance();
+  }
+  return it;
+}
+
+template <typename Key, typename Value>
+typename radix_map<Key, Value>::iterator radix_map<Key, Value>::find(
+    const Key& key) const {
+  // the same descent as find_leaf, recording the path for the iterator
+  Iterator it;
+  RadixKey bytes = encode(key);
+  const unsigned char* data = bytes.data();
+  NodeBase* node = root_;
+  size_t depth = 0;
+  while (node != nullptr && node->type != LEAF) {
+    Inner* inner = static_cast<Inner*>(node);
+    uint32_t stored = std::min(inner->prefix_len, kMaxPrefix);
+    if (depth + inner->prefix_len > bytes.size ||
+        std::memcmp(inner->prefix, data + depth, stored) != 0) {
+      return end();
+    }
+    depth += inner->prefix_len;
+    if (depth == bytes.size) {
+      it.stack_.push_back({inner, 0});
+      node = inner->leaf;
+    } else {
+      int pos = child_position(inner, data[depth]);
+      NodeBase** child = find_child(inner, data[depth]);
+      if (child == nullptr) return end();
+      it.stack_.push_back({inner, pos + 1});
+      node = *child;
+      ++depth;
+    }
+  }
+  Leaf* leaf = static_cast<Leaf*>(node);
+  if (leaf == nullptr || !leaf_matches(leaf, key)) return end();
+  it.leaf_ = leaf;
+  return it;
+}
+
+template <typename Key, typename Value>
+std::pair<typename radix_map<Key, Value>::iterator, bool>
+radix_map<Key, Value>::insert_leaf(const value_type& value, bool update) {
+  RadixKey bytes = encode(value.first);
+  const unsigned char* data = bytes.data();
+  NodeBase** ref = &root_;
+  size_t depth = 0;
+  Leaf* existing = nullptr;
+
+  while (true) {
+    NodeBase* node = *ref;
+    if (node == nullptr) {
+      *ref = new Leaf(value);
+      break;
+    }
+    if (node->type == LEAF) {
+      Leaf* leaf = static_cast<Leaf*>(node);
+      if (leaf_matches(leaf, value.first)) {
+        existing = leaf;
+        break;
+      }
+      // both keys share the bytes up to the first difference
+      RadixKey other = encode(leaf->data.first);
+      const unsigned char* other_data = other.data();
+      size_t len = 0;
+      while (depth + len < bytes.size && depth + len < other.size &&
+             data[depth + len] == other_data[depth + len]) {
+        ++len;
+      }
+      Node4* split = new Node4();
+      split->prefix_len = len;
+      std::memcpy(split->prefix, data + depth,
+                  len < kMaxPrefix ? len : kMaxPrefix);
+      NodeBase* split_ref = split;
+      size_t end = depth + len;
+      Leaf* added = new Leaf(value);
+      if (end == other.size) {
+        split->leaf = leaf;
+      } else {
+        add_child(split_ref, other_data[end], leaf);
+      }
+      if (end == bytes.size) {
+        static_cast<Inner*>(split_ref)->leaf = added;
+      } else {
+        add_child(split_ref, data[end], added);
+      }
+      *ref = split_ref;
+      break;
+    }
+
+    Inner* inner = static_cast<Inner*>(node);
+    uint32_t match = prefix_mismatch(inner, bytes, depth);
+    if (match < inner->prefix_len) {
+      // the key leaves the compressed path: split it at the mismatch
+      Node4* split = new Node4();
+      split->prefix_len = match;
+      std::memcpy(split->prefix, inner->prefix,
+                  match < kMaxPrefix ? match : kMaxPrefix);
+      NodeBase* split_ref = split;
+      unsigned char branch;
+      if (inner->prefix_len <= kMaxPrefix) {
+        branch = inner->prefix[match];
+        inner->prefix_len -= match + 1;
+        std::memmove(inner->prefix, inner->prefix + match + 1,
+                     inner->prefix_len);
+      } else {
+        RadixKey full = encode(min_leaf(inner)->data.first);
+        const unsigned char* full_data = full.data();
+        branch = full_data[depth + match];
+        inner->prefix_len -= match + 1;
+        std::memcpy(inner->prefix, full_data + depth + match + 1,
+                    inner->prefix_len < kMaxPrefix ? inner->prefix_len
+                                                   : kMaxPrefix);
+      }
+      add_child(split_ref, branch, inner);
+      Leaf* added = new Leaf(value);
+      if (depth + match == bytes.size) {
+        split->leaf = added;
+      } else {
+        add_child(split_ref, data[depth + match], added);
+      }
+      *ref = split_ref;
+      break;
+    }
+
+    depth += inner->prefix_len;
+    if (depth == bytes.size) {
+      if (inner->leaf != nullptr) {
+        existing = inner->leaf;
+      } else {
+        inner->leaf = new Leaf(value);
+      }
+      break;
+    }
+    NodeBase** child = find_child(inner, data[depth]);
+    if (child == nullptr) {
+      add_child(*ref, data[depth], new Leaf(value));
+      break;
+    }
+    ref = child;
+    ++depth;
+  }
+
+  if (existing != nullptr) {
+    if (update) existing->data.second = value.second;
+    return {find(value.first), false};
+  }
+  ++this->count_;
+  return {find(value.first), true};
+}
+
+template <typename Key, typename Value>
+bool radix_map<Key, Value>::erase_node(NodeBase*& ref, const Key& key,
+                                       const RadixKey& bytes, size_t depth) {
+  NodeBase* node = ref;
+  if (node == nullptr) return false;
+  if (node->type == LEAF) {
+    if (!leaf_matches(static_cast<Leaf*>(node), key)) return false;
+    delete static_cast<Leaf*>(node);
+    ref = nullptr;
+    return true;
+  }
+
+  Inner* inner = static_cast<Inner*>(node);
+  const unsigned char* data = bytes.data();
+  if (depth + inner->prefix_len > bytes.size) return false;
+  depth += inner->prefix_len;
+  if (depth == bytes.size) {
+    if (inner->leaf == nullptr || !leaf_matches(inner->leaf, key)) return false;
+    delete inner->leaf;
+    inner->leaf = nullptr;
+  } else {
+    NodeBase** child = find_child(inner, data[depth]);
+    if (child == nullptr || !erase_node(*child, key, bytes, depth + 1)) {
+      return false;
+    }
+    if (*child == nullptr) {
+      remove_child(ref, data[depth]);
+      inner = static_cast<Inner*>(ref);
+    }
+  }
+
+  // collapse nodes that no longer branch
+  if (inner->num_children == 0) {
+    ref = inner->leaf;
+    free_node(inner);
+  } else if (inner->num_children == 1 && inner->leaf == nullptr) {
+    NodeBase* child = nullptr;
+    int pos = next_child(inner, 0, &child);
+    if (child->type != LEAF) {
+      // the child takes over this node's prefix and the branch byte
+      Inner* below = static_cast<Inner*>(child);
+      unsigned char merged[kMaxPrefix];
+      uint32_t len = std::min(inner->prefix_len, kMaxPrefix);
+      std::memcpy(merged, inner->prefix, len);
+      if (len < kMaxPrefix) merged[len++] = branch_byte(inner, pos);
+      for (uint32_t i = 0; i < below->prefix_len && len < kMaxPrefix; ++i) {
+        merged[len++] = below->prefix[i];
+      }
+      below->prefix_len += inner->prefix_len + 1;
+      std::memcpy(below->prefix, merged, len);
+    }
+    ref = child;
+    free_node(inner);
+  }
+  return true;
+}
+
+template <typename Key, typename Value>
+typename radix_map<Key, Value>::size_type radix_map<Key, Value>::erase(
+    const Key& key) {
+  RadixKey bytes = encode(key);
+  if (!erase_node(root_, key, bytes, 0)) return 0;
+  --this->count_;
+  return 1;
+}
+
+}  // namespace s21
+
+#endif  // S21_RADIX_MAP_H
@@ -12,6 +12,9 @@ namespace s21 {
 
 template <typename Key>
 class set : public Tree<Key> {
+  static_assert(TreeOrdered<Key>::value,
+                "set and multiset keys must be comparable with operator>");
+
  public:
   using key_type = Key;
   using value_type = key_type;
@@ -4,8 +4,8 @@
 #include "s21_ordered_list.h"
 
 namespace s21 {
-template <typename T>
-class stack : public orderedList<T> {
+template <typename T, typename Allocator = NodePool<T>>
+class stack : public orderedList<T, Allocator> {
  public:
   using value_type = T;
   using reference = T &;
@@ -13,23 +13,29 @@ class stack : public orderedList<T> {
   using size_type = size_t;
   // для наследования всех конструкторв
   // using orderedList<value_type>::orderedList;
-  stack() : orderedList<value_type>(){};
+  stack() : orderedList<value_type, Allocator>(){};
   stack(std::initializer_list<value_type> const &items)
-      : orderedList<value_type>(items){};
+      : orderedList<value_type, Allocator>(items){};
   // copy constructor
-  stack(const stack &s) : orderedList<value_type>(s){};
+  stack(const stack &s) : orderedList<value_type, Allocator>(s){};
   // move constructor
-  stack(stack &&s) : orderedList<value_type>(std::move(s)){};
+  stack(stack &&s) : orderedList<value_type, Allocator>(std::move(s)){};
   // assignment operator overload for moving object
   stack &operator=(stack &&s) {
     return static_cast<stack &>(
-        orderedList<value_type>::operator=(std::move(s)));
+        orderedList<value_type, Allocator>::operator=(std::move(s)));
   }
   ~stack();
   // accesses the top element
-  const_reference top() { return this->back(); }
+  reference top() { return this->back(); }
   // inserts element at the top
   void push(const_reference value) { this->push_back(value); }
+  void push(value_type &&value) { this->push_back(std::move(value)); }
+  // constructs the element in its node from args
+  template <typename... Args>
+  reference emplace(Args &&...args) {
+    return this->emplace_back(std::forward<Args>(args)...);
+  }
   // removes the top element
   void pop();
 
@@ -40,32 +46,31 @@ class stack : public orderedList<T> {
 };
 }  // namespace s21
 
-template <typename T>
-s21::stack<T>::~stack() {
+template <typename T, typename Allocator>
+s21::stack<T, Allocator>::~stack() {
   while (this->tail_ != nullptr) pop();
   this->head_ = nullptr;
 }
 
-template <typename T>
-void s21::stack<T>::pop() {
+template <typename T, typename Allocator>
+void s21::stack<T, Allocator>::pop() {
   if (this->tail_ != nullptr) {
     auto *temp = this->tail_;
+    this->forget_positions();
     if (this->tail_->pPrev_ != nullptr) {
       this->tail_ = this->tail_->pPrev_;
       this->tail_->pNext_ = nullptr;
     } else
       this->tail_ = nullptr;
-    delete temp;
+    this->destroy_node(temp);
     this->count_--;
   }
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void s21::stack<T>::insert_many_front(Args &&...args) {
-  for (auto &arg : {args...}) {
-    push(arg);
-  }
+void s21::stack<T, Allocator>::insert_many_front(Args &&...args) {
+  (this->emplace_back(std::forward<Args>(args)), ...);
 }
 
 #endif
\ No newline at end of file
@@ -1,20 +1,82 @@
 #ifndef S21_TREE_H
 #define S21_TREE_H
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
 #include <iostream>
+#include <type_traits>
 #include <utility>  // Для std::pair
+#include <vector>
 
 #include "s21_container.h"
 #include "s21_list.h"
 
 namespace s21 {
 
-template <typename DataType>
+// Whether elements can be compared with >. std::pair declares its
+// comparisons for any members, so pairs are checked member by member.
+template <typename T, typename = void>
+struct TreeGreater : std::false_type {};
+
+template <typename T>
+struct TreeGreater<T, std::void_t<decltype(std::declval<const T&>() >
+                                           std::declval<const T&>())>>
+    : std::true_type {};
+
+template <typename T, typename = void>
+struct TreeLess : std::false_type {};
+
+template <typename T>
+struct TreeLess<T, std::void_t<decltype(std::declval<const T&>() <
+                                        std::declval<const T&>())>>
+    : std::true_type {};
+
+template <typename T>
+struct TreeOrdered : TreeGreater<T> {};
+
+// key-value elements: the containers holding them order by key and override
+// const_comparator
+template <typename T>
+struct TreeKeyValue : std::false_type {};
+
+template <typename First, typename Second>
+struct TreeKeyValue<std::pair<First, Second>> : std::true_type {};
+
+template <typename First, typename Second>
+struct TreeOrdered<std::pair<First, Second>>
+    : std::bool_constant<TreeLess<First>::value && TreeLess<Second>::value> {
+};
+
+// Aggregate of a subtree kept in every node of an augmented Tree
+template <typename Augment>
+struct TreeAggregate {
+  using value_type = typename Augment::value_type;
+  value_type aggregate{};
+};
+
+template <>
+struct TreeAggregate<void> {
+  using value_type = void;
+};
+
+// Augment is an optional monoid (see s21_monoid.h): every node then stores
+// the combination of its subtree, and aggregate() combines any key range in
+// O(height).
+template <typename DataType, typename Augment = void>
 class Tree : public Container<DataType> {
  public:
   using size_type = std::size_t;
+  using aggregate_type = typename TreeAggregate<Augment>::value_type;
   struct Node;
+  // SPLAY moves every found, inserted or erased element (the parent of an
+  // erased one) to the root, so frequently used keys stay near the top.
+  // SCAPEGOAT keeps the height below log(n) / log(3/2) by rebuilding a
+  // subtree that became too lopsided; it needs no extra fields in the nodes.
+  enum Balancing { UNBALANCED, SPLAY, SCAPEGOAT };
+
   Tree() : root_(nullptr) {}
+  explicit Tree(Balancing mode) : root_(nullptr), balancing_(mode) {}
   Tree(std::initializer_list<DataType> const& items);
   Tree(const Tree& t);
   Tree(Tree&& t);
@@ -32,6 +94,44 @@ class Tree : public Container<DataType> {
   void clear();
   void swap(Tree& other);
   virtual void merge(Tree& other);
+  // replaces the contents with count sorted elements read from first,
+  // builds a balanced tree in O(n) without comparisons
+  template <typename InputIt>
+  void build_sorted(InputIt first, size_type count);
+  // moves all nodes into one contiguous block in key order, so scans and
+  // searches touch neighbouring memory; invalidates iterators
+  void compact() {
+    while (!compact_step(this->count_ + 1)) {
+    }
+  }
+  // incremental compact(): moves at most max_nodes nodes, returns true when
+  // the whole tree has been laid out. The tree may be modified between the
+  // steps, nodes inserted meanwhile are left where they are.
+  bool compact_step(size_type max_nodes);
+
+  // can be switched at any time; the current shape is kept, except that
+  // switching to SCAPEGOAT rebuilds the whole tree
+  void set_balancing(Balancing mode) {
+    if (mode == SCAPEGOAT && balancing_ != SCAPEGOAT) {
+      rebuild(root_);
+      max_count_ = this->count_;
+    }
+    balancing_ = mode;
+  }
+  Balancing balancing() const { return balancing_; }
+
+  // combination of all elements, in key order
+  aggregate_type aggregate() const { return aggregate_of(root_); }
+  // combination of the elements in [lo, hi)
+  aggregate_type aggregate(const DataType& lo, const DataType& hi) const {
+    return aggregate_range(
+        [this, &lo](const DataType& data) {
+          return const_comparator(lo, data);
+        },
+        [this, &hi](const DataType& data) {
+          return !const_comparator(hi, data);
+        });
+  }
 
   Tree& operator=(Tree&& other);
 
@@ -42,45 +142,129 @@ class Tree : public Container<DataType> {
     INSERT_DUPLICATES = 3     // Inserting duplicates
   };
 
-  std::pair<typename Tree<DataType>::Iterator, bool> insert_tree(
+  std::pair<typename Tree<DataType, Augment>::Iterator, bool> insert_tree(
       const DataType& data, int mode);
+  // links a new node right before position (nullptr: after the last one)
+  // without a search; the caller makes sure the order is kept
+  Iterator insert_before(Node* position, const DataType& data);
   Iterator find_tree(const DataType& data);
   ConstIterator find_tree(const DataType& data) const;
-  void copy_tree(const Tree<DataType>& t);
+  void copy_tree(const Tree<DataType, Augment>& t);
   Node* find_min(Node* MinNode);
   Node* find_max(Node* node);
   const Node* find_min(const Node* node) const;
   const Node* find_max(const Node* node) const;
+  template <typename InputIt>
+  Node* build_subtree(InputIt& it, size_type count, Node* parent,
+                      Node*& previous);
+  static Node* successor(Node* node);
+  void rotate_up(Node* node);
+  void splay(Node* node);
+  // rebalances after new_node was inserted at the given depth
+  void scapegoat_insert(Node* new_node, size_type depth);
+  // makes the subtree of node perfectly balanced, keeping its nodes
+  void rebuild(Node* node);
+  Node* link_balanced(Node** nodes, size_type count, Node* parent);
+  static size_type subtree_size(const Node* node) {
+    return node == nullptr
+               ? 0
+               : 1 + subtree_size(node->left) + subtree_size(node->right);
+  }
+
+  static aggregate_type aggregate_of(const Node* node) {
+    return node != nullptr ? node->aggregate : Augment().identity();
+  }
+  // recomputes the aggregate of node from its children
+  void pull(Node* node);
+  // recomputes the aggregates from node up to the root
+  void pull_path(Node* node) {
+    if constexpr (!std::is_void_v<Augment>) {
+      for (; node != nullptr; node = node->parent) pull(node);
+    }
+  }
+  // combination of the elements that are neither below(data), which holds
+  // for a prefix of the elements, nor above(data), which holds for a suffix
+  template <typename Below, typename Above>
+  aggregate_type aggregate_range(Below below, Above above) const;
+
+  // Block of nodes allocated by compact(). Its nodes are destroyed in place
+  // and the block is freed with the last of them.
+  struct Arena {
+    Node* nodes;
+    size_type capacity;
+    size_type used;  // slots filled so far
+    size_type live;  // nodes not erased yet
+    bool contains(const Node* node) const {
+      return node >= nodes && node < nodes + capacity;
+    }
+    // ordering of arenas_ for std::upper_bound
+    static bool starts_after(const Node* node, const Arena& arena) {
+      return std::less<const Node*>()(node, arena.nodes);
+    }
+  };
+  // the block holding node, arenas_.end() for a node of its own; binary
+  // search, arenas_ is kept sorted by address
+  typename std::vector<Arena>::iterator find_arena(const Node* node);
+  void free_node(Node* node);
+  void move_to_arena(Node* node, Arena& arena);
+  void swap_arenas(Tree& other) {
+    std::swap(arenas_, other.arenas_);
+    std::swap(compact_cursor_, other.compact_cursor_);
+    std::swap(compact_block_, other.compact_block_);
+  }
 
   virtual bool const_comparator(const DataType& data1,
                                 const DataType& data2) const {
-    return data1 > data2;
+    if constexpr (TreeOrdered<DataType>::value) {
+      return data1 > data2;
+    } else {
+      // map and the like compare keys only and override this, their mapped
+      // values need no ordering; set and multiset cannot do without >
+      static_assert(TreeKeyValue<DataType>::value,
+                    "Tree elements must be comparable with operator>");
+      return false;
+    }
   }
 
   Node* root_ = nullptr;
+  Balancing balancing_ = UNBALANCED;
+  // set once equal elements have been inserted or built, a rebalanced or
+  // built tree can then have the first of them below a later one
+  bool duplicates_ = false;
+  // SCAPEGOAT: largest size since the whole tree was last rebuilt
+  size_type max_count_ = 0;
+  // compacted blocks sorted by address; while compact_cursor_ is set,
+  // compact_block_ is being filled and compact_cursor_ is the next node to
+  // move, in key order
+  std::vector<Arena> arenas_;
+  Node* compact_cursor_ = nullptr;
+  Node* compact_block_ = nullptr;
 };
 
 // -------------------- constructors and destructors ------------------------
-template <typename DataType>
-Tree<DataType>::Tree(std::initializer_list<DataType> const& items) {
+template <typename DataType, typename Augment>
+Tree<DataType, Augment>::Tree(std::initializer_list<DataType> const& items) {
   for (const auto& item : items) {
     insert_tree(item, INSERT_DUPLICATES);
   }
 }
 
-template <typename DataType>
-Tree<DataType>::Tree(const Tree<DataType>& t) : Tree() {
+template <typename DataType, typename Augment>
+Tree<DataType, Augment>::Tree(const Tree& t) : Tree(t.balancing_) {
   copy_tree(t);
 }
 
-template <typename DataType>
-Tree<DataType>::Tree(Tree<DataType>&& t) : Tree() {
+template <typename DataType, typename Augment>
+Tree<DataType, Augment>::Tree(Tree&& t) : Tree(t.balancing_) {
   std::swap(root_, t.root_);
   std::swap(this->count_, t.count_);
+  std::swap(duplicates_, t.duplicates_);
+  std::swap(max_count_, t.max_count_);
+  swap_arenas(t);
 }
 
-template <typename DataType>
-void Tree<DataType>::copy_tree(const Tree<DataType>& t) {
+template <typename DataType, typename Augment>
+void Tree<DataType, Augment>::copy_tree(const Tree& t) {
   clear();
   for (auto it = t.begin(); it != t.end(); ++it) {
     insert_tree(*it, INSERT_DUPLICATES);
@@ -88,17 +272,21 @@ void Tree<DataType>::copy_tree(const Tree<DataType>& t) {
   this->count_ = t.count_;
 }
 
-template <typename DataType>
-Tree<DataType>& Tree<DataType>::operator=(Tree<DataType>&& other) {
+template <typename DataType, typename Augment>
+Tree<DataType, Augment>& Tree<DataType, Augment>::operator=(Tree&& other) {
   clear();
   std::swap(this->root_, other.root_);
   std::swap(this->count_, other.count_);
+  std::swap(balancing_, other.balancing_);
+  std::swap(duplicates_, other.duplicates_);
+  std::swap(max_count_, other.max_count_);
+  swap_arenas(other);
   return *this;
 }
 
 // ---------------------------------- Node ---------------------------------
-template <typename DataType>
-struct Tree<DataType>::Node {
+template <typename DataType, typename Augment>
+struct Tree<DataType, Augment>::Node : TreeAggregate<Augment> {
   DataType data;
   Node* left = nullptr;
   Node* right = nullptr;
@@ -108,17 +296,24 @@ struct Tree<DataType>::Node {
 };
 
 // ---------------------------------- Iterator ---------------------------------
-template <typename DataType>
-class Tree<DataType>::Iterator {
+template <typename DataType, typename Augment>
+class Tree<DataType, Augment>::Iterator {
  protected:
   Node* current_;
-  Tree<DataType>* tree_;
+  Tree<DataType, Augment>* tree_;
 
  public:
-  Iterator(Node* node, Tree<DataType>& tree) : current_(node), tree_(&tree) {}
+  // in an augmented tree the elements are read-only: a write through the
+  // iterator would not reach the aggregates
+  using reference = std::conditional_t<std::is_void_v<Augment>, DataType&,
+                                       const DataType&>;
+  using pointer = std::conditional_t<std::is_void_v<Augment>, DataType*,
+                                     const DataType*>;
+
+  Iterator(Node* node, Tree& tree) : current_(node), tree_(&tree) {}
   Iterator(const Iterator& other) = default;
-  DataType& operator*() const { return current_->data; }
-  DataType* operator->() const { return &(current_->data); }
+  reference operator*() const { return current_->data; }
+  pointer operator->() const { return &(current_->data); }
   Iterator& operator++();
   Iterator operator++(int);
   Iterator& operator--();
@@ -147,14 +342,14 @@ class Tree<DataType>::Iterator {
   }
 };
 
-template <typename DataType>
-class Tree<DataType>::ConstIterator {
+template <typename DataType, typename Augment>
+class Tree<DataType, Augment>::ConstIterator {
  protected:
   const Node* current_;
-  const Tree<DataType>* tree_;
+  const Tree<DataType, Augment>* tree_;
 
  public:
-  ConstIterator(const Node* node, const Tree<DataType>* tree)
+  ConstIterator(const Node* node, const Tree<DataType, Augment>* tree)
       : current_(node), tree_(tree) {}
   ConstIterator(const ConstIterator& other) = default;
   const DataType& operator*() const { return current_->data; }
@@ -188,19 +383,20 @@ class Tree<DataType>::ConstIterator {
   }
 };
 
-template <typename DataType>
-typename Tree<DataType>::Iterator Tree<DataType>::begin() {
+template <typename DataType, typename Augment>
+typename Tree<DataType, Augment>::Iterator Tree<DataType, Augment>::begin() {
   Node* current = find_min(root_);
   return Iterator(current, *this);
 }
 
-template <typename DataType>
-typename Tree<DataType>::Iterator Tree<DataType>::end() {
+template <typename DataType, typename Augment>
+typename Tree<DataType, Augment>::Iterator Tree<DataType, Augment>::end() {
   return Iterator(nullptr, *this);
 }
 
-template <typename DataType>
-typename Tree<DataType>::Iterator& Tree<DataType>::Iterator::operator++() {
+template <typename DataType, typename Augment>
+typename Tree<DataType, Augment>::Iterator&
+Tree<DataType, Augment>::Iterator::operator++() {
   if (current_ == nullptr && tree_->count_) {
     current_ = tree_->find_min(tree_->root_);
   } else if (current_->right != nullptr) {
@@ -216,20 +412,21 @@ typename Tree<DataType>::Iterator& Tree<DataType>::Iterator::operator++() {
   return *this;
 }
 
-template <typename DataType>
-typename Tree<DataType>::Iterator Tree<DataType>::Iterator::operator++(int) {
+template <typename DataType, typename Augment>
+typename Tree<DataType, Augment>::Iterator
+Tree<DataType, Augment>::Iterator::operator++(int) {
   Iterator tmp = *this;
   ++(*this);
   return tmp;
 }
 
-template <typename DataType>
-typename Tree<DataType>::Iterator& Tree<DataType>::Iterator::operator--() {
+template <typename DataType, typename Augment>
+typename Tree<DataType, Augment>::Iterator&
+Tree<DataType, Augment>::Iterator::operator--() {
   if (current_ == nullptr && tree_->count_) {
     current_ = tree_->find_max(tree_->root_);
   } else if (current_->left != nullptr) {
-    current_ = current_->left;
-
+    current_ = tree_->find_max(current_->left);
   } else {
     Node* parent = current_->parent;
     while (parent != nullptr && current_ == parent->left) {
@@ -241,8 +438,9 @@ typename Tree<DataType>::Iterator& Tree<DataType>::Iterator::operator--() {
   return *this;
 }
 
-template <typename DataType>
-typename Tree<DataType>::Iterator Tree<DataType>::Iterator::operator--(int) {
+template <typename DataType, typename Augment>
+typename Tree<DataType, Augment>::Iterator
+Tree<DataType, Augment>::Iterator::operator--(int) {
   Iterator tmp = *this;
   --(*this);
   return tmp;
@@ -250,9 +448,9 @@ typename Tree<DataType>::Iterator Tree<DataType>::Iterator::operator--(int) {
 
 ////////////////////////////////////////////////////////////////////
 
-template <typename DataType>
-typename Tree<DataType>::ConstIterator&
-Tree<DataType>::ConstIterator::operator++() {
+template <typename DataType, typename Augment>
+typename Tree<DataType, Augment>::ConstIterator&
+Tree<DataType, Augment>::ConstIterator::operator++() {
   if (current_ == nullptr) {
     current_ = tree_->find_min(tree_->root_);
   } else if (current_->right != nullptr) {
@@ -268,17 +466,17 @@ Tree<DataType>::ConstIterator::operator++() {
   return *this;
 }
 
-template <typename DataType>
-typename Tree<DataType>::ConstIterator
-Tree<DataType>::ConstIterator::operator++(int) {
+template <typename DataType, typename Augment>
+typename Tree<DataType, Augment>::ConstIterator
+Tree<DataType, Augment>::ConstIterator::operator++(int) {
   ConstIterator tmp(*this);
   ++(*this);
   return tmp;
 }
 
-template <typename DataType>
-typename Tree<DataType>::ConstIterator&
-Tree<DataType>::ConstIterator::operator--() {
+template <typename DataType, typename Augment>
+typename Tree<DataType, Augment>::ConstIterator&
+Tree<DataType, Augment>::ConstIterator::operator--() {
   if (current_ == nullptr) {
     current_ = tree_->find_max(tree_->root_);
   } else if (current_->left != nullptr) {
@@ -294,78 +492,93 @@ Tree<DataType>::ConstIterator::operator--() {
   return *this;
 }
 
-template <typename DataType>
-typename Tree<DataType>::ConstIterator
-Tree<DataType>::ConstIterator::operator--(int) {
+template <typename DataType, typename Augment>
+typename Tree<DataType, Augment>::ConstIterator
+Tree<DataType, Augment>::ConstIterator::operator--(int) {
   ConstIterator tmp(*this);
   --(*this);
   return tmp;
 }
 
-template <typename DataType>
-typename Tree<DataType>::ConstIterator Tree<DataType>::begin() const {
+template <typename DataType, typename Augment>
+typename Tree<DataType, Augment>::ConstIterator Tree<DataType, Augment>::begin()
+    const {
   return ConstIterator(find_min(root_), this);
 }
 
 // ----------------------------  methods  ------------------------------
 
-template <typename DataType>
-typename Tree<DataType>::Node* Tree<DataType>::find_min(Node* MinNode) {
+template <typename DataType, typename Augment>
+typename Tree<DataType, Augment>::Node* Tree<DataType, Augment>::find_min(
+    Node* MinNode) {
   while (MinNode && MinNode->left) {
     MinNode = MinNode->left;
   }
   return MinNode;
 }
 
-template <typename DataType>
-const typename Tree<DataType>::Node* Tree<DataType>::find_min(
+template <typename DataType, typename Augment>
+const typename Tree<DataType, Augment>::Node* Tree<DataType, Augment>::find_min(
     const Node* node) const {
   if (!node) return nullptr;
   while (node->left) node = node->left;
   return node;
 }
 
-template <typename DataType>
-const typename Tree<DataType>::Node* Tree<DataType>::find_max(
+template <typename DataType, typename Augment>
+const typename Tree<DataType, Augment>::Node* Tree<DataType, Augment>::find_max(
     const Node* node) const {
   if (!node) return nullptr;
   while (node->right) node = node->right;
   return node;
 }
 
-template <typename DataType>
-typename Tree<DataType>::Node* Tree<DataType>::find_max(Node* node) {
+template <typename DataType, typename Augment>
+typename Tree<DataType, Augment>::Node* Tree<DataType, Augment>::find_max(
+    Node* node) {
   if (!node) return nullptr;
   while (node->right) node = node->right;
   return node;
 }
 
-template <typename DataType>
-void Tree<DataType>::clear() {
+template <typename DataType, typename Augment>
+void Tree<DataType, Augment>::clear() {
+  max_count_ = 0;  // no SCAPEGOAT rebuilds on the way
   while (root_ != nullptr) {
     erase(Iterator(root_, *this));
   }
   this->count_ = 0;
+  duplicates_ = false;
+  // only a block still being filled by compact_step can be left, empty
+  for (const Arena& arena : arenas_) ::operator delete(arena.nodes);
+  arenas_.clear();
+  compact_cursor_ = nullptr;
+  compact_block_ = nullptr;
 }
 
-template <typename DataType>
-std::pair<typename Tree<DataType>::Iterator, bool> Tree<DataType>::insert_tree(
-    const DataType& data, int mode) {
+template <typename DataType, typename Augment>
+std::pair<typename Tree<DataType, Augment>::Iterator, bool>
+Tree<DataType, Augment>::insert_tree(const DataType& data, int mode) {
   Node* current = root_;
   Node* parent = nullptr;
   bool isLeft = false;
+  size_type depth = 0;
 
   while (current != nullptr) {
+    ++depth;
     parent = current;  // Обновляем родителя на каждом шаге
     if (!const_comparator(data, current->data) &&
         !const_comparator(current->data, data)) {  // Элементы равны
       if (mode == INSERT_WITH_UPDATE) {
         current->data = data;
-        return {Iterator(current, *this), false};
-      } else if (mode == INSERT_NO_DUPLICATE) {
+        pull_path(current);
+      }
+      if (mode != INSERT_DUPLICATES) {
+        if (balancing_ == SPLAY) splay(current);
         return {Iterator(current, *this), false};
       }
       // Продолжаем движение вправо для режима с дубликатами
+      duplicates_ = true;
       isLeft = false;
       current = current->right;
     } else if (const_comparator(data, current->data)) {
@@ -387,32 +600,77 @@ std::pair<typename Tree<DataType>::Iterator, bool> Tree<DataType>::insert_tree(
   }
 
   this->count_++;
+  pull_path(newNode);
+  if (balancing_ == SPLAY) splay(newNode);
+  if (balancing_ == SCAPEGOAT) scapegoat_insert(newNode, depth);
   return {Iterator(newNode, *this), true};
 }
 
-template <typename DataType>
-typename Tree<DataType>::Iterator Tree<DataType>::find_tree(
+template <typename DataType, typename Augment>
+typename Tree<DataType, Augment>::Iterator
+Tree<DataType, Augment>::insert_before(Node* position, const DataType& data) {
+  Node* parent = nullptr;
+  bool isLeft = false;
+  if (position == nullptr) {
+    parent = find_max(root_);
+  } else if (position->left == nullptr) {
+    parent = position;
+    isLeft = true;
+  } else {
+    parent = find_max(position->left);
+  }
+  Node* newNode = new Node(data, parent);
+  size_type depth = 0;
+  if (parent == nullptr) {
+    root_ = newNode;
+  } else {
+    if (isLeft) {
+      parent->left = newNode;
+    } else {
+      parent->right = newNode;
+    }
+    for (Node* node = newNode; node->parent != nullptr; node = node->parent) {
+      ++depth;
+    }
+  }
+  this->count_++;
+  pull_path(newNode);
+  if (balancing_ == SPLAY) splay(newNode);
+  if (balancing_ == SCAPEGOAT) scapegoat_insert(newNode, depth);
+  return Iterator(newNode, *this);
+}
+
+template <typename DataType, typename Augment>
+typename Tree<DataType, Augment>::Iterator Tree<DataType, Augment>::find_tree(
     const DataType& data) {
   Node* current = root_;
+  Node* last = nullptr;
   Iterator result = end();
 
   while (current != nullptr) {
+    last = current;
     if (const_comparator(data, current->data)) {
       current = current->right;
     } else if (const_comparator(current->data, data)) {
       current = current->left;
     } else {
       result = Iterator(current, *this);
-      break;
+      // keep looking for the first of the duplicates
+      if (!duplicates_) break;
+      current = current->left;
     }
   }
+  // an unsuccessful search splays the last node it visited
+  if (balancing_ == SPLAY && last != nullptr) {
+    splay(result != end() ? result.getNode() : last);
+  }
 
   return result;
 }
 
-template <typename DataType>
-typename Tree<DataType>::ConstIterator Tree<DataType>::find_tree(
-    const DataType& data) const {
+template <typename DataType, typename Augment>
+typename Tree<DataType, Augment>::ConstIterator
+Tree<DataType, Augment>::find_tree(const DataType& data) const {
   Node* current = root_;
   ConstIterator result = end();
   while (current != nullptr) {
@@ -422,17 +680,22 @@ typename Tree<DataType>::ConstIterator Tree<DataType>::find_tree(
       current = current->left;
     } else {
       result = ConstIterator(current, this);
-      break;
+      if (!duplicates_) break;
+      current = current->left;
     }
   }
   return result;
 }
 
-template <typename DataType>
-void Tree<DataType>::erase(Iterator pos) {
+template <typename DataType, typename Augment>
+void Tree<DataType, Augment>::erase(Iterator pos) {
   if (pos.getNode() == nullptr) return;
 
   Node* toDelete = pos.getNode();
+  if (toDelete == compact_cursor_ &&
+      (toDelete->left == nullptr || toDelete->right == nullptr)) {
+    compact_cursor_ = successor(toDelete);
+  }
   Node* child = nullptr;
   Node* parent = nullptr;
 
@@ -466,6 +729,8 @@ void Tree<DataType>::erase(Iterator pos) {
   // Node have 2 child
   else {
     Node* successor = find_min(toDelete->right);
+    // the successor's data moves up into toDelete
+    if (successor == compact_cursor_) compact_cursor_ = toDelete;
     toDelete->data = successor->data;
     child = successor->right;
     parent = successor->parent;
@@ -477,18 +742,28 @@ void Tree<DataType>::erase(Iterator pos) {
     toDelete = successor;
   }
 
-  delete toDelete;
+  free_node(toDelete);
   --this->count_;
+  pull_path(parent);
+  if (balancing_ == SPLAY && parent != nullptr) splay(parent);
+  if (balancing_ == SCAPEGOAT && 3 * this->count_ < 2 * max_count_) {
+    rebuild(root_);
+    max_count_ = this->count_;
+  }
 }
 
-template <typename DataType>
-void Tree<DataType>::swap(Tree<DataType>& other) {
+template <typename DataType, typename Augment>
+void Tree<DataType, Augment>::swap(Tree<DataType, Augment>& other) {
   std::swap(other.root_, root_);
   std::swap(other.count_, this->count_);
+  std::swap(other.balancing_, balancing_);
+  std::swap(other.duplicates_, duplicates_);
+  std::swap(other.max_count_, max_count_);
+  swap_arenas(other);
 }
 
-template <typename DataType>
-void Tree<DataType>::merge(Tree<DataType>& other) {
+template <typename DataType, typename Augment>
+void Tree<DataType, Augment>::merge(Tree<DataType, Augment>& other) {
   if (this != &other) {
     Iterator it = other.begin();
     while (it != other.end()) {
@@ -503,5 +778,286 @@ void Tree<DataType>::merge(Tree<DataType>& other) {
   }
 }
 
+template <typename DataType, typename Augment>
+template <typename InputIt>
+void Tree<DataType, Augment>::build_sorted(InputIt first, size_type count) {
+  clear();
+  Node* previous = nullptr;
+  root_ = build_subtree(first, count, nullptr, previous);
+  this->count_ = count;
+  max_count_ = count;
+}
+
+// the left half is read first, so the input is consumed strictly in order
+template <typename DataType, typename Augment>
+template <typename InputIt>
+typename Tree<DataType, Augment>::Node* Tree<DataType, Augment>::build_subtree(
+    InputIt& it, size_type count, Node* parent, Node*& previous) {
+  if (count == 0) return nullptr;
+  size_type left_count = count / 2;
+  Node* left = build_subtree(it, left_count, nullptr, previous);
+  Node* node = new Node(*it, parent);
+  ++it;
+  // input is sorted, so equal elements are adjacent
+  if (previous != nullptr && !const_comparator(node->data, previous->data)) {
+    duplicates_ = true;
+  }
+  previous = node;
+  node->left = left;
+  if (left != nullptr) left->parent = node;
+  node->right = build_subtree(it, count - left_count - 1, node, previous);
+  pull(node);
+  return node;
+}
+
+template <typename DataType, typename Augment>
+typename Tree<DataType, Augment>::Node* Tree<DataType, Augment>::successor(
+    Node* node) {
+  if (node->right != nullptr) {
+    node = node->right;
+    while (node->left != nullptr) node = node->left;
+    return node;
+  }
+  Node* parent = node->parent;
+  while (parent != nullptr && node == parent->right) {
+    node = parent;
+    parent = parent->parent;
+  }
+  return parent;
+}
+
+template <typename DataType, typename Augment>
+void Tree<DataType, Augment>::pull(Node* node) {
+  if constexpr (!std::is_void_v<Augment>) {
+    Augment augment;
+    node->aggregate = augment.combine(
+        augment.combine(aggregate_of(node->left), augment(node->data)),
+        aggregate_of(node->right));
+  }
+}
+
+// Descends to the first node inside the range, then collects the parts of
+// its left subtree above the lower bound and of its right subtree below the
+// upper bound, each from whole subtree aggregates along one path.
+template <typename DataType, typename Augment>
+template <typename Below, typename Above>
+typename Tree<DataType, Augment>::aggregate_type
+Tree<DataType, Augment>::aggregate_range(Below below, Above above) const {
+  Augment augment;
+  const Node* split = root_;
+  while (split != nullptr) {
+    if (below(split->data)) {
+      split = split->right;
+    } else if (above(split->data)) {
+      split = split->left;
+    } else {
+      break;
+    }
+  }
+  if (split == nullptr) return augment.identity();
+  aggregate_type left = augment.identity();
+  for (const Node* node = split->left; node != nullptr;) {
+    if (below(node->data)) {
+      node = node->right;
+    } else {
+      left = augment.combine(
+          augment.combine(augment(node->data), aggregate_of(node->right)),
+          left);
+      node = node->left;
+    }
+  }
+  aggregate_type right = augment.identity();
+  for (const Node* node = split->right; node != nullptr;) {
+    if (above(node->data)) {
+      node = node->left;
+    } else {
+      right = augment.combine(
+          right,
+          augment.combine(aggregate_of(node->left), augment(node->data)));
+      node = node->right;
+    }
+  }
+  return augment.combine(augment.combine(left, augment(split->data)), right);
+}
+
+// lifts node one level, keeping the in-order sequence
+template <typename DataType, typename Augment>
+void Tree<DataType, Augment>::rotate_up(Node* node) {
+  Node* parent = node->parent;
+  Node* grand = parent->parent;
+  if (parent->left == node) {
+    parent->left = node->right;
+    if (node->right != nullptr) node->right->parent = parent;
+    node->right = parent;
+  } else {
+    parent->right = node->left;
+    if (node->left != nullptr) node->left->parent = parent;
+    node->left = parent;
+  }
+  parent->parent = node;
+  node->parent = grand;
+  pull(parent);
+  pull(node);
+  if (grand == nullptr) {
+    root_ = node;
+  } else if (grand->left == parent) {
+    grand->left = node;
+  } else {
+    grand->right = node;
+  }
+}
+
+// zig-zig rotates the parent first, zig-zag rotates the node twice
+template <typename DataType, typename Augment>
+void Tree<DataType, Augment>::splay(Node* node) {
+  while (node->parent != nullptr) {
+    Node* parent = node->parent;
+    Node* grand = parent->parent;
+    if (grand != nullptr) {
+      bool zig_zig = (grand->left == parent) == (parent->left == node);
+      rotate_up(zig_zig ? parent : node);
+    }
+    rotate_up(node);
+  }
+}
+
+// The new node is too deep, so some ancestor has a child subtree with more
+// than 2/3 of its nodes: the lowest such ancestor is rebuilt. Sizes are
+// counted on the way up, which is paid for by the rebuild.
+template <typename DataType, typename Augment>
+void Tree<DataType, Augment>::scapegoat_insert(Node* new_node,
+                                               size_type depth) {
+  if (this->count_ > max_count_) max_count_ = this->count_;
+  if (depth <= std::log(static_cast<double>(max_count_)) / std::log(1.5)) {
+    return;
+  }
+  Node* child = new_node;
+  size_type size = 1;
+  for (Node* node = child->parent; node != nullptr; node = node->parent) {
+    Node* sibling = node->left == child ? node->right : node->left;
+    size_type total = size + subtree_size(sibling) + 1;
+    if (3 * size > 2 * total) {
+      rebuild(node);
+      return;
+    }
+    size = total;
+    child = node;
+  }
+}
+
+template <typename DataType, typename Augment>
+void Tree<DataType, Augment>::rebuild(Node* node) {
+  if (node == nullptr) return;
+  Node* parent = node->parent;
+  bool isLeft = parent != nullptr && parent->left == node;
+  // in order, without recursion: the subtree may be a long path
+  std::vector<Node*> nodes;
+  Node* last = find_max(node);
+  for (Node* current = find_min(node);; current = successor(current)) {
+    nodes.push_back(current);
+    if (current == last) break;
+  }
+  Node* top = link_balanced(nodes.data(), nodes.size(), parent);
+  if (parent == nullptr) {
+    root_ = top;
+  } else if (isLeft) {
+    parent->left = top;
+  } else {
+    parent->right = top;
+  }
+}
+
+template <typename DataType, typename Augment>
+typename Tree<DataType, Augment>::Node* Tree<DataType, Augment>::link_balanced(
+    Node** nodes, size_type count, Node* parent) {
+  if (count == 0) return nullptr;
+  size_type middle = count / 2;
+  Node* node = nodes[middle];
+  node->parent = parent;
+  node->left = link_balanced(nodes, middle, node);
+  node->right = link_balanced(nodes + middle + 1, count - middle - 1, node);
+  pull(node);
+  return node;
+}
+
+template <typename DataType, typename Augment>
+typename std::vector<typename Tree<DataType, Augment>::Arena>::iterator
+Tree<DataType, Augment>::find_arena(const Node* node) {
+  // первый блок, начинающийся после node, а перед ним - кандидат
+  auto it = std::upper_bound(arenas_.begin(), arenas_.end(), node,
+                             Arena::starts_after);
+  if (it == arenas_.begin()) return arenas_.end();
+  --it;
+  return it->contains(node) ? it : arenas_.end();
+}
+
+template <typename DataType, typename Augment>
+void Tree<DataType, Augment>::free_node(Node* node) {
+  auto arena = find_arena(node);
+  if (arena == arenas_.end()) {
+    delete node;
+    return;
+  }
+  node->~Node();
+  // the block being filled by compact_step stays until the job ends
+  if (--arena->live == 0 && arena->nodes != compact_block_) {
+    ::operator delete(arena->nodes);
+    arenas_.erase(arena);
+  }
+}
+
+template <typename DataType, typename Augment>
+void Tree<DataType, Augment>::move_to_arena(Node* node, Arena& arena) {
+  // move: the elements may own memory, e.g. the groups of grouped_multimap
+  Node* moved = new (arena.nodes + arena.used) Node(std::move(*node));
+  ++arena.used;
+  ++arena.live;
+  if (moved->parent == nullptr) {
+    root_ = moved;
+  } else if (moved->parent->left == node) {
+    moved->parent->left = moved;
+  } else {
+    moved->parent->right = moved;
+  }
+  if (moved->left != nullptr) moved->left->parent = moved;
+  if (moved->right != nullptr) moved->right->parent = moved;
+  free_node(node);
+}
+
+template <typename DataType, typename Augment>
+bool Tree<DataType, Augment>::compact_step(size_type max_nodes) {
+  if (compact_cursor_ == nullptr) {
+    if (root_ == nullptr) return true;
+    Node* block =
+        static_cast<Node*>(::operator new(this->count_ * sizeof(Node)));
+    auto position = std::upper_bound(arenas_.begin(), arenas_.end(), block,
+                                     Arena::starts_after);
+    arenas_.insert(position, Arena{block, this->count_, 0, 0});
+    compact_block_ = block;
+    compact_cursor_ = find_min(root_);
+  }
+  // free_node keeps the block being filled, even with no live nodes
+  for (size_type moved = 0; compact_cursor_ != nullptr && moved < max_nodes;
+       ++moved) {
+    Arena& arena = *find_arena(compact_block_);
+    if (arena.used == arena.capacity) {
+      compact_cursor_ = nullptr;  // elements were inserted meanwhile
+      break;
+    }
+    Node* node = compact_cursor_;
+    compact_cursor_ = successor(node);
+    if (!arena.contains(node)) move_to_arena(node, arena);
+  }
+  if (compact_cursor_ == nullptr) {
+    auto arena = find_arena(compact_block_);
+    if (arena->live == 0) {
+      ::operator delete(arena->nodes);
+      arenas_.erase(arena);
+    }
+    compact_block_ = nullptr;
+  }
+  return compact_cursor_ == nullptr;
+}
+
 }  // namespace s21
 #endif  // S21_TREE_H
@@ -0,0 +1,93 @@
+#ifndef S21_UNORDERED_MAP_H
+#define S21_UNORDERED_MAP_H
+
+#include <functional>
+#include <utility>  // Для std::pair
+#include <vector>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+
+template <typename Key, typename Value>
+struct PairKeyOf {
+  const Key& operator()(const std::pair<Key, Value>& data) const {
+    return data.first;
+  }
+};
+
+// Unordered associative container on a flat Swiss table, see HashTable.
+// Iterators and references are invalidated by insertions that grow the
+// table, erase invalidates only the erased element.
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class unordered_map : public HashTable<std::pair<Key, Value>, Key,
+                                       PairKeyOf<Key, Value>, Hash> {
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<const Key, Value>;
+  using table_type =
+      HashTable<std::pair<Key, Value>, Key, PairKeyOf<Key, Value>, Hash>;
+  using iterator = typename table_type::Iterator;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = typename table_type::size_type;
+
+  using table_type::table_type;
+  using table_type::erase;
+
+  std::pair<iterator, bool> insert(const std::pair<const Key, Value>& value) {
+    return this->insert_table(value, table_type::INSERT_NO_DUPLICATE);
+  }
+
+  std::pair<iterator, bool> insert(const Key& key, const Value& obj) {
+    return this->insert_table(std::make_pair(key, obj),
+                              table_type::INSERT_NO_DUPLICATE);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const Value& obj) {
+    return this->insert_table(std::make_pair(key, obj),
+                              table_type::INSERT_WITH_UPDATE);
+  }
+
+  iterator find(const Key& key) const {
+    return iterator(this, this->find_slot(key));
+  }
+
+  // Доступ к элементу по ключу
+  Value& at(const Key& key) {
+    iterator it = find(key);
+    if (it == this->end()) {
+      throw std::out_of_range("Key not found");
+    }
+    return (*it).second;
+  }
+
+  // Доступ или вставка элемента по заданному ключу
+  Value& operator[](const Key& key) {
+    iterator it = find(key);
+    if (it == this->end()) {
+      it = this->insert_table(std::make_pair(key, Value{}),
+                              table_type::INSERT_NO_DUPLICATE)
+               .first;
+    }
+    return (*it).second;
+  }
+
+  bool contains(const Key& key) const {
+    return this->find_slot(key) != this->capacity_;
+  }
+
+  size_type erase(const Key& key) { return this->erase_key(key); }
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    std::vector<std::pair<iterator, bool>> results;
+    (void)(results.push_back(this->insert(std::forward<Args>(args))), ...);
+    return results;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_UNORDERED_MAP_H
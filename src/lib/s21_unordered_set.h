@@ -0,0 +1,57 @@
+#ifndef S21_UNORDERED_SET_H
+#define S21_UNORDERED_SET_H
+
+#include <functional>
+#include <utility>  // Для std::pair
+#include <vector>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+
+template <typename Key>
+struct IdentityKeyOf {
+  const Key& operator()(const Key& data) const { return data; }
+};
+
+// Unordered set on a flat Swiss table, see HashTable.
+template <typename Key, typename Hash = std::hash<Key>>
+class unordered_set
+    : public HashTable<Key, Key, IdentityKeyOf<Key>, Hash> {
+ public:
+  using key_type = Key;
+  using value_type = key_type;
+  using table_type = HashTable<Key, Key, IdentityKeyOf<Key>, Hash>;
+  using iterator = typename table_type::Iterator;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = typename table_type::size_type;
+
+  using table_type::table_type;
+  using table_type::erase;
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return this->insert_table(value, table_type::INSERT_NO_DUPLICATE);
+  }
+
+  iterator find(const Key& key) const {
+    return iterator(this, this->find_slot(key));
+  }
+
+  bool contains(const Key& key) const {
+    return this->find_slot(key) != this->capacity_;
+  }
+
+  size_type erase(const Key& key) { return this->erase_key(key); }
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    std::vector<std::pair<iterator, bool>> results;
+    (void)(results.push_back(this->insert(std::forward<Args>(args))), ...);
+    return results;
+  }
+};
+
+}  // namespace s21
+
+#endif  // S21_UNORDERED_SET_H
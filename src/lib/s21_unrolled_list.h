@@ -0,0 +1,577 @@
+#ifndef S21_UNROLLED_LIST_H
+#define S21_UNROLLED_LIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_container.h"
+
+namespace s21 {
+
+// Doubly linked list of chunks, each holding up to kCapacity elements next
+// to each other (ChunkBytes of them, at least two). Same interface as
+// s21::list. An insert into a full chunk splits it in halves; an erase
+// merges two neighbouring chunks once they fill at most 3/4 of one. Unlike
+// s21::list, insert and erase invalidate iterators into the chunks they
+// touch, splice into the middle of a chunk splits it, and sort and merge
+// move the elements instead of relinking nodes.
+template <typename T, std::size_t ChunkBytes = 256>
+class unrolled_list : public Container<T> {
+ public:
+  template <bool Const>
+  class Iterator;
+
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+  using size_type = std::size_t;
+
+  static constexpr size_type kCapacity =
+      ChunkBytes / sizeof(T) > 2 ? ChunkBytes / sizeof(T) : 2;
+
+  unrolled_list() = default;
+  explicit unrolled_list(size_type n) {
+    for (size_type i = 0; i < n; ++i) push_back(value_type());
+  }
+  unrolled_list(std::initializer_list<value_type> const& items) {
+    for (const_reference item : items) push_back(item);
+  }
+  unrolled_list(const unrolled_list& other) {
+    for (const_reference item : other) push_back(item);
+  }
+  unrolled_list(unrolled_list&& other) noexcept { swap(other); }
+  // copies or moves, depending on how other was made
+  unrolled_list& operator=(unrolled_list other) noexcept {
+    swap(other);
+    return *this;
+  }
+  ~unrolled_list() { clear(); }
+
+  // clears the contents
+  void clear();
+  // inserts value before pos, returns the iterator to it
+  iterator insert(iterator pos, const_reference value) {
+    return insert_value(pos, value);
+  }
+  iterator insert(iterator pos, value_type&& value) {
+    return insert_value(pos, std::move(value));
+  }
+  // constructs the element from args and moves it into its chunk
+  template <typename... Args>
+  iterator emplace(iterator pos, Args&&... args) {
+    return insert_value(pos, value_type(std::forward<Args>(args)...));
+  }
+  // erases the element at pos, returns the iterator following it
+  iterator erase(iterator pos) { return erase_count(pos, 1); }
+  // erases elements [first, last), returns the iterator following them
+  iterator erase(iterator first, iterator last);
+  void push_back(const_reference value) { insert_value(end(), value); }
+  void push_back(value_type&& value) { insert_value(end(), std::move(value)); }
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    return *emplace(end(), std::forward<Args>(args)...);
+  }
+  void pop_back();
+  void push_front(const_reference value) { emplace_front(value); }
+  void push_front(value_type&& value) { emplace_front(std::move(value)); }
+  template <typename... Args>
+  reference emplace_front(Args&&... args);
+  void pop_front();
+  // merges two sorted lists, stable, O(n+m); other is left empty
+  void merge(unrolled_list& other) { merge(other, std::less<value_type>()); }
+  template <typename Compare>
+  void merge(unrolled_list& other, Compare comp);
+  // moves all elements of other before pos without copying them
+  void splice(const_iterator pos, unrolled_list& other);
+  void reverse();
+  // removes consecutive duplicates, returns their number
+  size_type unique() { return unique(std::equal_to<value_type>()); }
+  template <typename BinaryPredicate>
+  size_type unique(BinaryPredicate pred);
+  size_type remove(const_reference value);
+  template <typename Predicate>
+  size_type remove_if(Predicate pred);
+  // stable
+  void sort() { sort(std::less<value_type>()); }
+  template <typename Compare>
+  void sort(Compare comp);
+  void swap(unrolled_list& other) noexcept {
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    std::swap(this->count_, other.count_);
+  }
+
+  reference front() { return head_->data()[0]; }
+  const_reference front() const { return head_->data()[0]; }
+  reference back() { return tail_->data()[tail_->count - 1]; }
+  const_reference back() const { return tail_->data()[tail_->count - 1]; }
+
+  iterator begin() { return iterator(head_, 0, this); }
+  iterator end() { return iterator(nullptr, 0, this); }
+  const_iterator begin() const { return const_iterator(head_, 0, this); }
+  const_iterator end() const { return const_iterator(nullptr, 0, this); }
+
+  size_type chunk_count() const {
+    size_type result = 0;
+    for (Chunk* chunk = head_; chunk != nullptr; chunk = chunk->next) ++result;
+    return result;
+  }
+
+  // ------------------- Доп. задание ---------------------------------------
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args&&... args);
+  template <typename... Args>
+  void insert_many_back(Args&&... args) {
+    (push_back(std::forward<Args>(args)), ...);
+  }
+  template <typename... Args>
+  void insert_many_front(Args&&... args) {
+    insert_many(begin(), std::forward<Args>(args)...);
+  }
+
+ protected:
+  struct Chunk {
+    Chunk* next = nullptr;
+    Chunk* prev = nullptr;
+    size_type count = 0;
+    alignas(T) unsigned char storage[kCapacity * sizeof(T)];
+
+    T* data() { return reinterpret_cast<T*>(storage); }
+  };
+
+  Chunk* head_ = nullptr;
+  Chunk* tail_ = nullptr;
+
+  template <typename U>
+  iterator insert_value(iterator pos, U&& value);
+  iterator erase_count(iterator pos, size_type n);
+  // new empty chunk after prev, at the head for nullptr
+  Chunk* link_chunk(Chunk* prev);
+  // frees an empty chunk
+  void unlink_chunk(Chunk* chunk);
+  // moves the elements from at on to a new chunk after chunk, returns it
+  Chunk* split(Chunk* chunk, size_type at);
+  // moves the next chunk into left when both are at most 3/4 full together;
+  // pos is kept pointing at the same element
+  void merge_next(Chunk* left, iterator& pos);
+  // removes the elements with drop(kept, element), kept being the last
+  // element left before it (nullptr at first), moving the rest forward
+  template <typename Drop>
+  size_type compact_where(Drop drop);
+};
+
+template <typename T, std::size_t ChunkBytes>
+template <bool Const>
+class unrolled_list<T, ChunkBytes>::Iterator {
+ public:
+  using list_type =
+      std::conditional_t<Const, const unrolled_list, unrolled_list>;
+  using reference = std::conditional_t<Const, const T&, T&>;
+  using pointer = std::conditional_t<Const, const T*, T*>;
+
+  Iterator(Chunk* chunk = nullptr, size_type index = 0,
+           list_type* list = nullptr)
+      : chunk_(chunk), index_(index), list_(list) {}
+  // iterator -> const_iterator
+  template <bool OtherConst,
+            typename = std::enable_if_t<Const && !OtherConst>>
+  Iterator(const Iterator<OtherConst>& other)
+      : chunk_(other.chunk_), index_(other.index_), list_(other.list_) {}
+
+  reference operator*() const { return chunk_->data()[index_]; }
+  pointer operator->() const { return chunk_->data() + index_; }
+
+  Iterator& operator++() {
+    if (++index_ == chunk_->count) {
+      chunk_ = chunk_->next;
+      index_ = 0;
+    }
+    return *this;
+  }
+  Iterator operator++(int) {
+    Iterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+  // from end() to the last element
+  Iterator& operator--() {
+    if (chunk_ == nullptr) {
+      chunk_ = list_->tail_;
+      index_ = chunk_->count - 1;
+    } else if (index_ == 0) {
+      chunk_ = chunk_->prev;
+      index_ = chunk_->count - 1;
+    } else {
+      --index_;
+    }
+    return *this;
+  }
+  Iterator operator--(int) {
+    Iterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  bool operator==(const Iterator& other) const {
+    return chunk_ == other.chunk_ && index_ == other.index_;
+  }
+  bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+ private:
+  friend class unrolled_list;
+  template <bool>
+  friend class Iterator;
+
+  Chunk* chunk_;
+  size_type index_;
+  list_type* list_;
+};
+
+template <typename T, std::size_t ChunkBytes>
+void unrolled_list<T, ChunkBytes>::clear() {
+  while (head_ != nullptr) {
+    Chunk* next = head_->next;
+    T* data = head_->data();
+    for (size_type i = 0; i < head_->count; ++i) data[i].~T();
+    delete head_;
+    head_ = next;
+  }
+  tail_ = nullptr;
+  this->count_ = 0;
+}
+
+// вставка в полный блок сначала делит его пополам
+template <typename T, std::size_t ChunkBytes>
+template <typename U>
+typename unrolled_list<T, ChunkBytes>::iterator
+unrolled_list<T, ChunkBytes>::insert_value(iterator pos, U&& value) {
+  // value может быть элементом этого листа, который сдвинется
+  value_type item(std::forward<U>(value));
+  Chunk* chunk = pos.chunk_;
+  size_type index = pos.index_;
+  if (chunk == nullptr) {
+    chunk = tail_;
+    if (chunk == nullptr || chunk->count == kCapacity) {
+      chunk = link_chunk(tail_);
+    }
+    index = chunk->count;
+  } else if (chunk->count == kCapacity) {
+    Chunk* upper = split(chunk, kCapacity / 2);
+    if (index > chunk->count) {
+      index -= chunk->count;
+      chunk = upper;
+    }
+  }
+  T* data = chunk->data();
+  if (index == chunk->count) {
+    new (data + index) T(std::move(item));
+  } else {
+    new (data + chunk->count) T(std::move(data[chunk->count - 1]));
+    for (size_type i = chunk->count - 1; i > index; --i) {
+      data[i] = std::move(data[i - 1]);
+    }
+    data[index] = std::move(item);
+  }
+  ++chunk->count;
+  ++this->count_;
+  return iterator(chunk, index, this);
+}
+
+template <typename T, std::size_t ChunkBytes>
+typename unrolled_list<T, ChunkBytes>::iterator
+unrolled_list<T, ChunkBytes>::erase(iterator first, iterator last) {
+  size_type n = 0;
+  for (iterator it = first; it != last; ++it) ++n;
+  return erase_count(first, n);
+}
+
+// удаляет n элементов начиная с pos: в каждом блоке одним сдвигом, пустые
+// блоки освобождаются, в конце соседние блоки могут слиться
+template <typename T, std::size_t ChunkBytes>
+typename unrolled_list<T, ChunkBytes>::iterator
+unrolled_list<T, ChunkBytes>::erase_count(iterator pos, size_type n) {
+  if (n == 0) return pos;
+  Chunk* chunk = pos.chunk_;
+  size_type index = pos.index_;
+  while (n > 0 && chunk != nullptr) {
+    size_type take = std::min(n, chunk->count - index);
+    T* data = chunk->data();
+    for (size_type i = index; i + take < chunk->count; ++i) {
+      data[i] = std::move(data[i + take]);
+    }
+    for (size_type i = chunk->count - take; i < chunk->count; ++i) {
+      data[i].~T();
+    }
+    chunk->count -= take;
+    this->count_ -= take;
+    n -= take;
+    if (chunk->count == 0) {
+      Chunk* next = chunk->next;
+      unlink_chunk(chunk);
+      chunk = next;
+      index = 0;
+    } else if (index == chunk->count) {
+      chunk = chunk->next;
+      index = 0;
+    }
+  }
+  iterator result(chunk, index, this);
+  Chunk* around = chunk != nullptr ? chunk : tail_;
+  if (around != nullptr) {
+    Chunk* before = around->prev;
+    merge_next(around, result);
+    if (before != nullptr) merge_next(before, result);
+  }
+  return result;
+}
+
+template <typename T, std::size_t ChunkBytes>
+void unrolled_list<T, ChunkBytes>::pop_back() {
+  if (tail_ == nullptr) throw std::out_of_range("List is empty");
+  erase(--end());
+}
+
+template <typename T, std::size_t ChunkBytes>
+template <typename... Args>
+T& unrolled_list<T, ChunkBytes>::emplace_front(Args&&... args) {
+  // элемент строится до нового блока: args могут ссылаться на front()
+  value_type item(std::forward<Args>(args)...);
+  if (head_ == nullptr || head_->count == kCapacity) link_chunk(nullptr);
+  return *insert_value(begin(), std::move(item));
+}
+
+template <typename T, std::size_t ChunkBytes>
+void unrolled_list<T, ChunkBytes>::pop_front() {
+  if (head_ == nullptr) throw std::out_of_range("List is empty");
+  erase(begin());
+}
+
+// элементы переносятся в новый лист по порядку, старые блоки освобождаются
+template <typename T, std::size_t ChunkBytes>
+template <typename Compare>
+void unrolled_list<T, ChunkBytes>::merge(unrolled_list& other, Compare comp) {
+  if (this == &other || other.count_ == 0) return;
+  unrolled_list merged;
+  iterator first = begin();
+  iterator second = other.begin();
+  while (first != end() && second != other.end()) {
+    if (comp(*second, *first)) {
+      merged.insert_value(merged.end(), std::move(*second++));
+    } else {
+      merged.insert_value(merged.end(), std::move(*first++));
+    }
+  }
+  for (; first != end(); ++first) {
+    merged.insert_value(merged.end(), std::move(*first));
+  }
+  for (; second != other.end(); ++second) {
+    merged.insert_value(merged.end(), std::move(*second));
+  }
+  swap(merged);
+  other.clear();
+}
+
+template <typename T, std::size_t ChunkBytes>
+void unrolled_list<T, ChunkBytes>::splice(const_iterator pos,
+                                          unrolled_list& other) {
+  if (this == &other || other.count_ == 0) return;
+  Chunk* after = pos.chunk_;
+  if (after != nullptr && pos.index_ != 0) after = split(after, pos.index_);
+  Chunk* before = after != nullptr ? after->prev : tail_;
+  other.head_->prev = before;
+  other.tail_->next = after;
+  if (before != nullptr)
+    before->next = other.head_;
+  else
+    head_ = other.head_;
+  if (after != nullptr)
+    after->prev = other.tail_;
+  else
+    tail_ = other.tail_;
+  this->count_ += other.count_;
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+  other.count_ = 0;
+}
+
+template <typename T, std::size_t ChunkBytes>
+void unrolled_list<T, ChunkBytes>::reverse() {
+  for (Chunk* chunk = head_; chunk != nullptr; chunk = chunk->prev) {
+    std::swap(chunk->next, chunk->prev);
+    std::reverse(chunk->data(), chunk->data() + chunk->count);
+  }
+  std::swap(head_, tail_);
+}
+
+template <typename T, std::size_t ChunkBytes>
+template <typename BinaryPredicate>
+typename unrolled_list<T, ChunkBytes>::size_type
+unrolled_list<T, ChunkBytes>::unique(BinaryPredicate pred) {
+  return compact_where([&pred](const T* kept, const T& item) {
+    return kept != nullptr && pred(*kept, item);
+  });
+}
+
+// элементы сдвигаются, поэтому сравниваем с копией value
+template <typename T, std::size_t ChunkBytes>
+typename unrolled_list<T, ChunkBytes>::size_type
+unrolled_list<T, ChunkBytes>::remove(const_reference value) {
+  value_type target(value);
+  return remove_if([&target](const T& item) { return item == target; });
+}
+
+template <typename T, std::size_t ChunkBytes>
+template <typename Predicate>
+typename unrolled_list<T, ChunkBytes>::size_type
+unrolled_list<T, ChunkBytes>::remove_if(Predicate pred) {
+  return compact_where(
+      [&pred](const T*, const T& item) { return pred(item); });
+}
+
+// элементы на время сортировки переезжают в буфер и обратно по местам
+template <typename T, std::size_t ChunkBytes>
+template <typename Compare>
+void unrolled_list<T, ChunkBytes>::sort(Compare comp) {
+  if (this->count_ <= 1) return;
+  std::vector<value_type> buffer;
+  buffer.reserve(this->count_);
+  for (reference item : *this) buffer.push_back(std::move(item));
+  std::stable_sort(buffer.begin(), buffer.end(), comp);
+  auto sorted = buffer.begin();
+  for (reference item : *this) item = std::move(*sorted++);
+}
+
+// после каждой вставки pos снова указывает на тот же элемент: вставка могла
+// разделить его блок
+template <typename T, std::size_t ChunkBytes>
+template <typename... Args>
+typename unrolled_list<T, ChunkBytes>::iterator
+unrolled_list<T, ChunkBytes>::insert_many(const_iterator pos, Args&&... args) {
+  iterator next(pos.chunk_, pos.index_, this);
+  ((next = ++insert_value(next, std::forward<Args>(args))), ...);
+  for (size_type i = 0; i < sizeof...(Args); ++i) --next;
+  return next;
+}
+
+template <typename T, std::size_t ChunkBytes>
+typename unrolled_list<T, ChunkBytes>::Chunk*
+unrolled_list<T, ChunkBytes>::link_chunk(Chunk* prev) {
+  Chunk* chunk = new Chunk;
+  Chunk* next = prev != nullptr ? prev->next : head_;
+  chunk->prev = prev;
+  chunk->next = next;
+  if (prev != nullptr)
+    prev->next = chunk;
+  else
+    head_ = chunk;
+  if (next != nullptr)
+    next->prev = chunk;
+  else
+    tail_ = chunk;
+  return chunk;
+}
+
+template <typename T, std::size_t ChunkBytes>
+void unrolled_list<T, ChunkBytes>::unlink_chunk(Chunk* chunk) {
+  if (chunk->prev != nullptr)
+    chunk->prev->next = chunk->next;
+  else
+    head_ = chunk->next;
+  if (chunk->next != nullptr)
+    chunk->next->prev = chunk->prev;
+  else
+    tail_ = chunk->prev;
+  delete chunk;
+}
+
+template <typename T, std::size_t ChunkBytes>
+typename unrolled_list<T, ChunkBytes>::Chunk*
+unrolled_list<T, ChunkBytes>::split(Chunk* chunk, size_type at) {
+  Chunk* upper = link_chunk(chunk);
+  T* from = chunk->data();
+  T* to = upper->data();
+  for (size_type i = at; i < chunk->count; ++i) {
+    new (to + i - at) T(std::move(from[i]));
+    from[i].~T();
+  }
+  upper->count = chunk->count - at;
+  chunk->count = at;
+  return upper;
+}
+
+template <typename T, std::size_t ChunkBytes>
+void unrolled_list<T, ChunkBytes>::merge_next(Chunk* left, iterator& pos) {
+  Chunk* right = left->next;
+  if (right == nullptr || 4 * (left->count + right->count) > 3 * kCapacity) {
+    return;
+  }
+  T* from = right->data();
+  T* to = left->data() + left->count;
+  for (size_type i = 0; i < right->count; ++i) {
+    new (to + i) T(std::move(from[i]));
+    from[i].~T();
+  }
+  if (pos.chunk_ == right) {
+    pos.chunk_ = left;
+    pos.index_ += left->count;
+  }
+  left->count += right->count;
+  right->count = 0;
+  unlink_chunk(right);
+}
+
+// оставшиеся элементы сдвигаются вперёд на свободные места, границы блоков
+// не меняются; хвост, оставшийся пустым, освобождается
+template <typename T, std::size_t ChunkBytes>
+template <typename Drop>
+typename unrolled_list<T, ChunkBytes>::size_type
+unrolled_list<T, ChunkBytes>::compact_where(Drop drop) {
+  size_type removed = 0;
+  Chunk* write_chunk = head_;
+  size_type write_index = 0;
+  const T* kept = nullptr;
+  for (Chunk* chunk = head_; chunk != nullptr; chunk = chunk->next) {
+    for (size_type i = 0; i < chunk->count; ++i) {
+      T& item = chunk->data()[i];
+      if (drop(kept, item)) {
+        ++removed;
+        continue;
+      }
+      if (write_index == write_chunk->count) {
+        write_chunk = write_chunk->next;
+        write_index = 0;
+      }
+      T& slot = write_chunk->data()[write_index++];
+      if (&slot != &item) slot = std::move(item);
+      kept = &slot;
+    }
+  }
+  if (removed == 0) return 0;
+  this->count_ -= removed;
+  if (kept == nullptr) {
+    clear();
+    return removed;
+  }
+  T* data = write_chunk->data();
+  for (size_type i = write_index; i < write_chunk->count; ++i) data[i].~T();
+  write_chunk->count = write_index;
+  while (write_chunk->next != nullptr) {
+    Chunk* chunk = write_chunk->next;
+    for (size_type i = 0; i < chunk->count; ++i) chunk->data()[i].~T();
+    unlink_chunk(chunk);
+  }
+  return removed;
+}
+
+}  // namespace s21
+
+#endif  // S21_UNROLLED_LIST_H
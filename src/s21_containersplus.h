@@ -2,6 +2,26 @@
 #define S21_CONTAINERSPLUS_H
 
 #include "lib/s21_array.h"
+#include "lib/s21_compact_map.h"
+#include "lib/s21_compact_set.h"
+#include "lib/s21_concurrent_unordered_map.h"
+#include "lib/s21_external_sort.h"
+#include "lib/s21_frozen_map.h"
+#include "lib/s21_frozen_set.h"
+#include "lib/s21_incremental_unordered_map.h"
+#include "lib/s21_interval_map.h"
+#include "lib/s21_intrusive_list.h"
+#include "lib/s21_mapped_map.h"
+#include "lib/s21_mapped_set.h"
+#include "lib/s21_monoid.h"
+#include "lib/s21_multimap.h"
 #include "lib/s21_multiset.h"
+#include "lib/s21_node_pool.h"
+#include "lib/s21_persistent_map.h"
+#include "lib/s21_persistent_set.h"
+#include "lib/s21_radix_map.h"
+#include "lib/s21_unordered_map.h"
+#include "lib/s21_unordered_set.h"
+#include "lib/s21_unrolled_list.h"
  
 #endif
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../lib/s21_compact_map.h"
+
+TEST(compactMap, InsertAccess) {
+  s21::compact_map<int, std::string> map = {{2, "two"}, {1, "one"}};
+  EXPECT_TRUE(map.insert(3, "three").second);
+  EXPECT_FALSE(map.insert(std::make_pair(3, "tres")).second);
+  map.insert_or_assign(3, "tres");
+  EXPECT_EQ(map.at(3), "tres");
+  EXPECT_EQ(map[4], "");
+  map[4] = "four";
+  EXPECT_EQ(map.find(4)->second, "four");
+  EXPECT_THROW(map.at(5), std::out_of_range);
+  EXPECT_TRUE(map.contains(1));
+  EXPECT_FALSE(map.contains(5));
+  auto results = map.insert_many(std::make_pair(5, "five"),
+                                 std::make_pair(1, "uno"));
+  EXPECT_TRUE(results[0].second);
+  EXPECT_FALSE(results[1].second);
+  int expected_key = 1;
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    EXPECT_EQ(it->first, expected_key++);
+  }
+}
+
+TEST(compactMap, EraseKeepsOrder) {
+  s21::compact_map<int, int> map;
+  for (int i = 0; i < 100; ++i) map.insert((i * 37) % 100, i);
+  for (int i = 0; i < 100; i += 3) map.erase(map.find(i));
+  int previous = -1;
+  size_t count = 0;
+  for (const auto& item : map) {
+    EXPECT_GT(item.first, previous);
+    EXPECT_NE(item.first % 3, 0);
+    previous = item.first;
+    ++count;
+  }
+  EXPECT_EQ(count, map.size());
+}
+
+namespace {
+// a mapped value without any ordering
+struct Point {
+  int x = 0;
+  int y = 0;
+};
+}  // namespace
+
+TEST(compactMap, ValueWithoutOrdering) {
+  s21::compact_map<int, Point> map;
+  EXPECT_TRUE(map.insert(2, Point{1, 2}).second);
+  EXPECT_TRUE(map.insert(1, Point{3, 4}).second);
+  EXPECT_FALSE(map.insert(2, Point{5, 6}).second);
+  map.insert_or_assign(2, Point{5, 6});
+  EXPECT_EQ(map.at(2).x, 5);
+  EXPECT_EQ(map.begin()->first, 1);
+  map.erase(map.find(1));
+  EXPECT_EQ(map.size(), 1);
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <vector>
+
+#include "../lib/s21_compact_set.h"
+
+static std::vector<int> items_of(const s21::compact_set<int>& set) {
+  std::vector<int> items;
+  for (auto it = set.begin(); it != set.end(); ++it) items.push_back(*it);
+  return items;
+}
+
+TEST(compactSet, InsertFindErase) {
+  s21::compact_set<int> set = {5, 3, 8};
+  EXPECT_EQ(set.size(), 3);
+  EXPECT_TRUE(set.insert(1).second);
+  EXPECT_FALSE(set.insert(5).second);
+  EXPECT_TRUE(set.contains(8));
+  EXPECT_EQ(*set.find(3), 3);
+  EXPECT_TRUE(set.find(4) == set.end());
+  set.erase(set.find(5));
+  EXPECT_FALSE(set.contains(5));
+  EXPECT_EQ(items_of(set), (std::vector<int>{1, 3, 8}));
+  auto it = set.end();
+  --it;
+  EXPECT_EQ(*it, 8);
+}
+
+TEST(compactSet, NodeIsSixteenBytes) {
+  EXPECT_EQ(sizeof(s21::compact_set<int>::Node), 16);
+}
+
+TEST(compactSet, RandomOperationsMatchStdSet) {
+  std::mt19937 rng(29);
+  s21::compact_set<int> set;
+  std::set<int> expected;
+  for (int i = 0; i < 20000; ++i) {
+    int key = rng() % 3000;
+    if (rng() % 3 == 0) {
+      auto it = set.find(key);
+      EXPECT_EQ(it != set.end(), expected.erase(key) == 1);
+      set.erase(it);
+    } else {
+      EXPECT_EQ(set.insert(key).second, expected.insert(key).second);
+    }
+  }
+  EXPECT_EQ(set.size(), expected.size());
+  EXPECT_EQ(items_of(set),
+            std::vector<int>(expected.begin(), expected.end()));
+  // erased slots are reused
+  EXPECT_LE(set.memory_usage(),
+            2 * (expected.size() + 1000) * sizeof(s21::compact_set<int>::Node));
+}
+
+TEST(compactSet, MergeAndBuildSorted) {
+  s21::compact_set<int> set = {1, 3, 5};
+  s21::compact_set<int> other = {5, 2, 4, 6, 0};
+  set.merge(other);
+  EXPECT_EQ(set.size(), 7);
+  EXPECT_EQ(items_of(other), (std::vector<int>{5}));
+
+  std::vector<int> sorted = {10, 20, 30, 40, 50};
+  s21::compact_set<int> built;
+  built.build_sorted(sorted.begin(), sorted.size());
+  EXPECT_EQ(built.size(), 5);
+  EXPECT_EQ(items_of(built), sorted);
+  s21::compact_set<int> copy(built);
+  built.clear();
+  EXPECT_TRUE(built.empty());
+  EXPECT_TRUE(copy.contains(30));
+}
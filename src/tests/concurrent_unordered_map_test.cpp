@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../lib/s21_concurrent_unordered_map.h"
+
+TEST(concurrentUnorderedMap, SingleThread) {
+  s21::concurrent_unordered_map<int, std::string> map(4);
+  EXPECT_EQ(map.segment_count(), 4);
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.insert(1, "one"));
+  EXPECT_FALSE(map.insert(1, "uno"));
+  EXPECT_EQ(map.at(1), "one");
+  EXPECT_FALSE(map.insert_or_assign(1, "uno"));
+  EXPECT_TRUE(map.insert_or_assign(2, "two"));
+  EXPECT_EQ(map.at(1), "uno");
+  EXPECT_TRUE(map.update(2, [](const std::string& v) { return v + "!"; }));
+  EXPECT_FALSE(map.update(3, [](const std::string& v) { return v; }));
+  std::string value;
+  EXPECT_TRUE(map.find(2, value));
+  EXPECT_EQ(value, "two!");
+  EXPECT_FALSE(map.find(3, value));
+  EXPECT_THROW(map.at(3), std::out_of_range);
+  EXPECT_EQ(map.erase(1), 1);
+  EXPECT_EQ(map.erase(1), 0);
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_EQ(map.size(), 1);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_FALSE(map.contains(2));
+}
+
+TEST(concurrentUnorderedMap, GrowsAndVisitsAll) {
+  s21::concurrent_unordered_map<int, int> map(2);
+  for (int i = 0; i < 10000; ++i) map.insert(i, i * 2);
+  EXPECT_EQ(map.size(), 10000);
+  long long sum = 0;
+  size_t visited = 0;
+  map.for_each([&](const std::pair<const int, int>& item) {
+    EXPECT_EQ(item.second, item.first * 2);
+    sum += item.second;
+    ++visited;
+  });
+  EXPECT_EQ(visited, 10000);
+  EXPECT_EQ(sum, 9999LL * 10000);
+  for (int i = 0; i < 10000; i += 2) EXPECT_EQ(map.erase(i), 1);
+  for (int i = 0; i < 10000; ++i) EXPECT_EQ(map.contains(i), i % 2 == 1);
+}
+
+TEST(concurrentUnorderedMap, ConcurrentWritersAndReaders) {
+  s21::concurrent_unordered_map<int, long> map(8);
+  const int kThreads = 4;
+  const int kKeys = 2000;
+  for (int key = 0; key < kKeys; ++key) map.insert(key, 0);
+
+  std::vector<std::thread> threads;
+  // every writer adds 1 to every key, updates must not be lost
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&] {
+      for (int key = 0; key < kKeys; ++key) {
+        map.update(key, [](long v) { return v + 1; });
+      }
+    });
+  }
+  // inserts and erases of other keys force resizes next to the updates
+  threads.emplace_back([&] {
+    for (int key = kKeys; key < 5 * kKeys; ++key) map.insert(key, -1);
+    for (int key = kKeys; key < 5 * kKeys; ++key) map.erase(key);
+  });
+  threads.emplace_back([&] {
+    for (int round = 0; round < 20; ++round) {
+      for (int key = 0; key < kKeys; ++key) {
+        long value = -1;
+        EXPECT_TRUE(map.find(key, value));
+        EXPECT_GE(value, 0);
+        EXPECT_LE(value, kThreads);
+      }
+    }
+  });
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(map.size(), static_cast<size_t>(kKeys));
+  for (int key = 0; key < kKeys; ++key) EXPECT_EQ(map.at(key), kThreads);
+}
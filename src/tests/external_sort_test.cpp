@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../lib/s21_external_sort.h"
+
+template <typename T>
+static std::string write_records(const std::string& name,
+                                 const std::vector<T>& records) {
+  std::string path = testing::TempDir() + "s21_" + name + ".bin";
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char*>(records.data()),
+            records.size() * sizeof(T));
+  return path;
+}
+
+static std::vector<uint64_t> random_keys(size_t n, uint64_t range) {
+  std::mt19937_64 rng(7);
+  std::vector<uint64_t> keys(n);
+  for (auto& key : keys) key = rng() % range;
+  return keys;
+}
+
+TEST(externalSort, SortsManyRunsWithinBudget) {
+  // 200000 keys with a 192 KiB budget give dozens of runs and several
+  // merge passes
+  std::vector<uint64_t> keys = random_keys(200000, 1000000);
+  std::string input = write_records("ext_input", keys);
+  s21::ExternalSorter<uint64_t> sorter(192 * 1024, testing::TempDir(), 2);
+
+  std::vector<uint64_t> sorted;
+  size_t count =
+      sorter.sort(input, [&sorted](uint64_t key) { sorted.push_back(key); });
+
+  std::vector<uint64_t> expected = keys;
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(count, expected.size());
+  EXPECT_EQ(sorted, expected);
+
+  sorter.set_unique(true);
+  sorted.clear();
+  count =
+      sorter.sort(input, [&sorted](uint64_t key) { sorted.push_back(key); });
+  std::set<uint64_t> unique(keys.begin(), keys.end());
+  EXPECT_EQ(count, unique.size());
+  EXPECT_TRUE(std::equal(sorted.begin(), sorted.end(), unique.begin()));
+}
+
+TEST(externalSort, SortToFile) {
+  std::vector<int> keys = {5, 3, 5, 1, 4, 1, 2};
+  std::string input = write_records("ext_small", keys);
+  std::string output = testing::TempDir() + "s21_ext_small.sorted";
+  s21::ExternalSorter<int> sorter(0, testing::TempDir());
+  EXPECT_FALSE(sorter.unique());
+  EXPECT_EQ(sorter.sort(input, output), 7);
+  {
+    s21::RunReader<int> reader(output, 2);
+    int value = 0;
+    for (int expected : {1, 1, 2, 3, 4, 5, 5}) {
+      ASSERT_TRUE(reader.next(value));
+      EXPECT_EQ(value, expected);
+    }
+    EXPECT_FALSE(reader.next(value));
+  }
+
+  sorter.set_unique(true);
+  EXPECT_EQ(sorter.sort(input, output), 5);
+  s21::RunReader<int> reader(output, 2);
+  int value = 0;
+  for (int expected = 1; expected <= 5; ++expected) {
+    ASSERT_TRUE(reader.next(value));
+    EXPECT_EQ(value, expected);
+  }
+  EXPECT_FALSE(reader.next(value));
+}
+
+TEST(externalSort, EmptyInput) {
+  std::string input = write_records("ext_empty", std::vector<int>{});
+  s21::set<int> set = {1, 2};
+  EXPECT_EQ(s21::external_load(input, set, 1 << 20, testing::TempDir()), 0);
+  EXPECT_TRUE(set.empty());
+}
+
+TEST(externalSort, MissingInputThrows) {
+  s21::ExternalSorter<int> sorter(1 << 20, testing::TempDir());
+  EXPECT_THROW(sorter.sort(testing::TempDir() + "s21_no_such_file",
+                           [](int) {}),
+               std::runtime_error);
+}
+
+TEST(externalSort, ThrowingSinkRemovesRuns) {
+  std::string dir = testing::TempDir() + "s21_ext_cleanup";
+  std::filesystem::create_directories(dir);
+  std::string input = write_records("ext_cleanup", random_keys(50000, 1000));
+  s21::ExternalSorter<uint64_t> sorter(192 * 1024, dir, 2);
+  size_t seen = 0;
+  EXPECT_THROW(sorter.sort(input,
+                           [&seen](uint64_t) {
+                             if (++seen == 1000) throw std::runtime_error("");
+                           }),
+               std::runtime_error);
+  EXPECT_TRUE(std::filesystem::is_empty(dir));
+  std::filesystem::remove(dir);
+}
+
+TEST(externalSort, LoadSet) {
+  std::vector<uint64_t> keys = random_keys(50000, 20000);
+  std::string input = write_records("ext_set", keys);
+  s21::set<uint64_t> set;
+  size_t count = s21::external_load(input, set, 128 * 1024, testing::TempDir());
+
+  std::set<uint64_t> expected(keys.begin(), keys.end());
+  EXPECT_EQ(count, expected.size());
+  EXPECT_EQ(set.size(), expected.size());
+  auto it = set.begin();
+  for (uint64_t key : expected) EXPECT_EQ(*it++, key);
+  EXPECT_TRUE(set.contains(keys[123]));
+  EXPECT_FALSE(set.contains(20000));
+  // the bulk built tree stays a regular tree
+  set.insert(20000);
+  set.erase(set.find(keys[0]));
+  EXPECT_EQ(set.size(), expected.size());
+}
+
+TEST(externalSort, LoadMapFirstRecordWins) {
+  using Record = s21::MappedPair<int, int>;
+  std::vector<Record> records;
+  for (int i = 0; i < 3000; ++i) records.push_back({(i * 37) % 1000, i});
+  std::string input = write_records("ext_map", records);
+
+  s21::map<int, int> map;
+  EXPECT_EQ(s21::external_load(input, map, 0, testing::TempDir()), 1000);
+  EXPECT_EQ(map.size(), 1000);
+  for (int i = 0; i < 1000; ++i) EXPECT_EQ(map.at((i * 37) % 1000), i);
+}
+
+TEST(externalSort, WriteImage) {
+  std::vector<uint64_t> keys = random_keys(30000, 10000);
+  std::string input = write_records("ext_image", keys);
+  std::string image_path = testing::TempDir() + "s21_ext.img";
+  size_t count = s21::external_write_image<uint64_t>(input, image_path,
+                                                     256 * 1024,
+                                                     testing::TempDir());
+  s21::mapped_set<uint64_t> image(image_path);
+  std::set<uint64_t> expected(keys.begin(), keys.end());
+  EXPECT_EQ(count, expected.size());
+  EXPECT_TRUE(std::equal(image.begin(), image.end(), expected.begin()));
+}
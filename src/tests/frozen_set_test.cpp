@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "../lib/s21_frozen_map.h"
+#include "../lib/s21_frozen_set.h"
+
+TEST(frozenSet, EmptySet) {
+  s21::frozen_set<int> set;
+  EXPECT_TRUE(set.empty());
+  EXPECT_FALSE(set.contains(0));
+  EXPECT_TRUE(set.begin() == set.end());
+  EXPECT_TRUE(set.lower_bound(5) == set.end());
+}
+
+TEST(frozenSet, BuildFromSet) {
+  s21::set<int> source = {8, 3, 10, 1, 6, 14, 4, 7, 13};
+  s21::frozen_set<int> set(source);
+  EXPECT_EQ(set.size(), 9);
+  auto it = set.begin();
+  for (auto sit = source.begin(); sit != source.end(); ++sit, ++it) {
+    EXPECT_EQ(*it, *sit);
+  }
+  EXPECT_TRUE(it == set.end());
+  EXPECT_TRUE(set.contains(13));
+  EXPECT_FALSE(set.contains(2));
+  EXPECT_EQ(*set.find(6), 6);
+  EXPECT_TRUE(set.find(9) == set.end());
+}
+
+TEST(frozenSet, LowerBoundMatchesStd) {
+  // every size up to 70 covers complete and partial last levels
+  for (int n = 1; n <= 70; ++n) {
+    std::vector<int64_t> keys;
+    for (int i = 0; i < n; ++i) keys.push_back(i * 3);
+    s21::frozen_set<int64_t> set(keys.begin(), keys.end());
+    for (int64_t probe = -2; probe <= n * 3 + 2; ++probe) {
+      auto expected = std::lower_bound(keys.begin(), keys.end(), probe);
+      auto it = set.lower_bound(probe);
+      if (expected == keys.end()) {
+        EXPECT_TRUE(it == set.end());
+      } else {
+        ASSERT_TRUE(it != set.end());
+        EXPECT_EQ(*it, *expected);
+      }
+      EXPECT_EQ(set.contains(probe), probe >= 0 && probe % 3 == 0 &&
+                                         probe < n * 3);
+    }
+  }
+}
+
+TEST(frozenSet, IterationVisitsSortedOrder) {
+  std::vector<uint32_t> keys;
+  for (uint32_t i = 0; i < 1000; ++i) keys.push_back(i * 7 + 1);
+  s21::frozen_set<uint32_t> set(keys.begin(), keys.end());
+  std::vector<uint32_t> visited;
+  for (auto it = set.begin(); it != set.end(); it++) visited.push_back(*it);
+  EXPECT_EQ(visited, keys);
+}
+
+TEST(frozenMap, BuildAndLookup) {
+  s21::map<int, std::string> source = {{2, "two"}, {1, "one"}, {3, "three"}};
+  s21::frozen_map<int, std::string> map(source);
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(map.at(2), "two");
+  EXPECT_EQ(map[3], "three");
+  EXPECT_THROW(map.at(4), std::out_of_range);
+  EXPECT_TRUE(map.contains(1));
+  EXPECT_FALSE(map.contains(0));
+  EXPECT_EQ((*map.find(1)).second, "one");
+  EXPECT_TRUE(map.find(7) == map.end());
+  EXPECT_EQ((*map.lower_bound(0)).first, 1);
+
+  int expected = 1;
+  for (auto it = map.begin(); it != map.end(); ++it, ++expected) {
+    EXPECT_EQ((*it).first, expected);
+  }
+}
+
+TEST(frozenMap, BuildFromSortedRange) {
+  std::vector<std::pair<int, double>> items;
+  for (int i = 0; i < 100; ++i) items.push_back({i * 2, i * 0.5});
+  s21::frozen_map<int, double> map(items.begin(), items.end());
+  for (int i = 0; i < 100; ++i) EXPECT_DOUBLE_EQ(map.at(i * 2), i * 0.5);
+  EXPECT_FALSE(map.contains(1));
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include "../lib/s21_incremental_unordered_map.h"
+
+TEST(incrementalUnorderedMap, InsertAccess) {
+  s21::incremental_unordered_map<int, std::string> map = {{1, "one"},
+                                                          {2, "two"}};
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_TRUE(map.insert(3, "three").second);
+  EXPECT_FALSE(map.insert(std::make_pair(3, "tres")).second);
+  map.insert_or_assign(3, "tres");
+  EXPECT_EQ(map.at(3), "tres");
+  EXPECT_EQ(map[4], "");
+  map[4] = "four";
+  EXPECT_EQ(map.at(4), "four");
+  EXPECT_THROW(map.at(5), std::out_of_range);
+  EXPECT_EQ(map.erase(1), 1);
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_EQ(map.size(), 3);
+}
+
+TEST(incrementalUnorderedMap, GrowthIsSpreadOverOperations) {
+  s21::incremental_unordered_map<int, int> map;
+  bool seen_migration = false;
+  for (int i = 0; i < 5000; ++i) {
+    map.insert(i, i);
+    seen_migration = seen_migration || map.is_migrating();
+    // every key stays reachable in the middle of a migration
+    if (i % 97 == 0) {
+      for (int j = 0; j <= i; j += 13) ASSERT_EQ(map.at(j), j);
+    }
+  }
+  EXPECT_TRUE(seen_migration);
+  EXPECT_EQ(map.size(), 5000);
+  size_t visited = 0;
+  for (auto it = map.begin(); it != map.end(); ++it) ++visited;
+  EXPECT_EQ(visited, 5000);
+}
+
+TEST(incrementalUnorderedMap, RandomOperationsMatchStd) {
+  std::mt19937 rng(23);
+  s21::incremental_unordered_map<int, int> map;
+  std::unordered_map<int, int> expected;
+  for (int i = 0; i < 60000; ++i) {
+    int key = rng() % 20000;
+    switch (rng() % 4) {
+      case 0:
+        EXPECT_EQ(map.erase(key), expected.erase(key));
+        break;
+      case 1:
+      case 2:
+        map.insert_or_assign(key, i);
+        expected[key] = i;
+        break;
+      default:
+        EXPECT_EQ(map.contains(key), expected.count(key) == 1);
+    }
+    ASSERT_EQ(map.size(), expected.size());
+  }
+  size_t visited = 0;
+  for (auto it = map.begin(); it != map.end(); ++it, ++visited) {
+    EXPECT_EQ(it->second, expected.at(it->first));
+  }
+  EXPECT_EQ(visited, expected.size());
+}
+
+TEST(incrementalUnorderedMap, CopyMoveClearDuringMigration) {
+  s21::incremental_unordered_map<int, int> map;
+  int n = 0;
+  for (; !map.is_migrating() || n < 100; ++n) map.insert(n, n);
+  ASSERT_TRUE(map.is_migrating());
+
+  s21::incremental_unordered_map<int, int> copy(map);
+  EXPECT_EQ(copy.size(), map.size());
+  for (int i = 0; i < n; ++i) EXPECT_EQ(copy.at(i), i);
+
+  map.erase(map.begin());
+  EXPECT_EQ(map.size(), static_cast<size_t>(n - 1));
+
+  s21::incremental_unordered_map<int, int> moved(std::move(map));
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(moved.size(), static_cast<size_t>(n - 1));
+  moved.reserve(10 * n);
+  EXPECT_FALSE(moved.is_migrating());
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+  EXPECT_TRUE(moved.begin() == moved.end());
+  moved.insert(1, 1);
+  EXPECT_EQ(moved.at(1), 1);
+}
+
+TEST(incrementalUnorderedMap, LowerMaxLoadFactorWhileFilled) {
+  s21::incremental_unordered_map<int, int> map;
+  for (int i = 0; i < 15; ++i) map.insert(i, i);
+  map.max_load_factor(0.125f);
+  for (int i = 15; i < 300; ++i) {
+    map.insert(i, i);
+    EXPECT_LE(map.load_factor(), map.max_load_factor());
+  }
+  EXPECT_EQ(map.size(), 300);
+  for (int i = 0; i < 300; ++i) EXPECT_EQ(map.at(i), i);
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../lib/s21_interval_map.h"
+
+using Interval = std::pair<std::pair<int, int>, int>;
+
+// intervals overlapping [lo, hi] in (start, end) order, by a full scan
+static std::vector<Interval> Overlapping(std::vector<Interval> all, int lo,
+                                         int hi) {
+  std::vector<Interval> result;
+  for (const auto& item : all) {
+    if (item.first.first <= hi && item.first.second >= lo) {
+      result.push_back(item);
+    }
+  }
+  std::stable_sort(result.begin(), result.end(),
+                   [](const Interval& a, const Interval& b) {
+                     return a.first < b.first;
+                   });
+  return result;
+}
+
+TEST(IntervalMapTest, StabbingAndOverlap) {
+  s21::interval_map<int, int> map = {
+      {{1, 5}, 10}, {{3, 4}, 20}, {{6, 9}, 30}, {{8, 8}, 40}};
+  EXPECT_EQ(map.size(), 4);
+  auto hits = map.stabbing(4);
+  ASSERT_EQ(hits.size(), 2);
+  EXPECT_EQ((*hits[0]).second, 10);
+  EXPECT_EQ((*hits[1]).second, 20);
+  EXPECT_EQ(map.stabbing(8).size(), 2);
+  EXPECT_TRUE(map.stabbing(10).empty());
+  EXPECT_TRUE(map.overlaps(5, 6));
+  EXPECT_FALSE(map.overlaps(10, 20));
+  EXPECT_EQ(map.overlapping(0, 100).size(), 4);
+}
+
+TEST(IntervalMapTest, InsertRejectsReversedInterval) {
+  s21::interval_map<int, int> map;
+  EXPECT_THROW(map.insert(5, 1, 0), std::invalid_argument);
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(IntervalMapTest, FindAndEraseEqualIntervals) {
+  s21::interval_map<int, int> map;
+  map.insert(2, 4, 1);
+  map.insert(2, 4, 2);
+  map.insert(2, 3, 3);
+  auto it = map.find(2, 4);
+  ASSERT_TRUE(it != map.end());
+  EXPECT_EQ((*it).second, 1);
+  map.erase(it);
+  EXPECT_EQ((*map.find(2, 4)).second, 2);
+  EXPECT_TRUE(map.find(1, 4) == map.end());
+  EXPECT_EQ(map.stabbing(4).size(), 1);
+}
+
+TEST(IntervalMapTest, MatchesScanUnderInsertAndErase) {
+  s21::interval_map<int, int> map;
+  std::vector<Interval> all;
+  std::mt19937 rng(11);
+  for (int i = 0; i < 2000; ++i) {
+    // mostly in order of the start, like sessions being logged
+    int lo = i / 2 + static_cast<int>(rng() % 20);
+    int hi = lo + static_cast<int>(rng() % 60);
+    map.insert(lo, hi, i);
+    all.push_back({{lo, hi}, i});
+    if (i % 3 == 2) {
+      size_t victim = rng() % all.size();
+      auto it = map.find(all[victim].first.first, all[victim].first.second);
+      ASSERT_TRUE(it != map.end());
+      // the first equal interval in map order is the earliest inserted one
+      auto first = std::find_if(all.begin(), all.end(),
+                                [&it](const Interval& item) {
+                                  return item.first == (*it).first;
+                                });
+      all.erase(first);
+      map.erase(it);
+    }
+  }
+  EXPECT_EQ(map.size(), all.size());
+  for (int lo = -5; lo < 1100; lo += 37) {
+    for (int width : {0, 3, 50}) {
+      std::vector<Interval> expected = Overlapping(all, lo, lo + width);
+      std::vector<Interval> found;
+      map.for_each_overlapping(lo, lo + width, [&found](const Interval& item) {
+        found.push_back(item);
+      });
+      EXPECT_EQ(found, expected) << lo << " " << width;
+      EXPECT_EQ(map.overlaps(lo, lo + width), !expected.empty());
+    }
+  }
+}
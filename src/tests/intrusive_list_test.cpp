@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../lib/s21_intrusive_list.h"
+
+struct Task {
+  explicit Task(int id = 0) : id(id) {}
+  bool operator<(const Task& other) const { return id < other.id; }
+
+  int id;
+  s21::intrusive_list_hook<Task> ready;
+  s21::intrusive_list_hook<Task> all;
+};
+
+using ReadyList = s21::intrusive_list<Task, &Task::ready>;
+using AllList = s21::intrusive_list<Task, &Task::all>;
+
+// обход вперёд и назад, чтобы проверить обе связи
+template <typename List>
+static std::vector<int> Ids(List& list) {
+  std::vector<int> forward;
+  for (auto it = list.begin(); it != list.end(); ++it) {
+    forward.push_back(it->id);
+  }
+  std::vector<int> backward;
+  for (auto it = list.end(); it != list.begin();) {
+    backward.push_back((--it)->id);
+  }
+  EXPECT_EQ(std::vector<int>(backward.rbegin(), backward.rend()), forward);
+  EXPECT_EQ(forward.size(), list.size());
+  return forward;
+}
+
+TEST(IntrusiveList, LinksObjectsInPlace) {
+  std::vector<Task> tasks;
+  for (int i = 0; i < 5; ++i) tasks.emplace_back(i);
+  ReadyList ready;
+  AllList all;
+  EXPECT_TRUE(ready.empty());
+  for (Task& task : tasks) all.push_back(task);
+  ready.push_back(tasks[2]);
+  ready.push_front(tasks[0]);
+  ready.insert(ready.iterator_to(tasks[2]), tasks[1]);
+  EXPECT_EQ(&ready.front(), &tasks[0]);
+  EXPECT_EQ(&ready.back(), &tasks[2]);
+  EXPECT_EQ(Ids(ready), (std::vector<int>{0, 1, 2}));
+  EXPECT_EQ(Ids(all), (std::vector<int>{0, 1, 2, 3, 4}));
+  auto next = ready.erase(ready.iterator_to(tasks[1]));
+  EXPECT_EQ(next->id, 2);
+  EXPECT_EQ(tasks[1].ready.pNext_, nullptr);
+  EXPECT_EQ(Ids(ready), (std::vector<int>{0, 2}));
+  all.erase(++all.begin(), --all.end());
+  EXPECT_EQ(Ids(all), (std::vector<int>{0, 4}));
+  ready.pop_front();
+  ready.pop_back();
+  EXPECT_TRUE(ready.empty());
+  EXPECT_THROW(ready.pop_back(), std::out_of_range);
+  EXPECT_THROW(ready.front(), std::out_of_range);
+  ready.push_back(tasks[1]);
+  EXPECT_EQ(Ids(ready), (std::vector<int>{1}));
+}
+
+TEST(IntrusiveList, CopiedElementStartsUnlinked) {
+  Task first(1);
+  ReadyList ready;
+  ready.push_back(first);
+  Task copy = first;
+  EXPECT_EQ(copy.ready.pPrev_, nullptr);
+  ready.push_back(copy);
+  copy = first;
+  EXPECT_EQ(&ready.back(), &copy);
+  EXPECT_EQ(Ids(ready), (std::vector<int>{1, 1}));
+}
+
+TEST(IntrusiveList, Splice) {
+  std::vector<Task> tasks;
+  for (int i = 0; i < 8; ++i) tasks.emplace_back(i);
+  ReadyList ready, blocked;
+  for (Task& task : tasks) ready.push_back(task);
+  blocked.splice(blocked.end(), ready, ready.iterator_to(tasks[3]));
+  blocked.splice(blocked.begin(), ready, ready.begin());
+  EXPECT_EQ(Ids(ready), (std::vector<int>{1, 2, 4, 5, 6, 7}));
+  EXPECT_EQ(Ids(blocked), (std::vector<int>{0, 3}));
+  blocked.splice(++blocked.begin(), ready, ready.iterator_to(tasks[4]),
+                 ready.iterator_to(tasks[7]));
+  EXPECT_EQ(Ids(ready), (std::vector<int>{1, 2, 7}));
+  EXPECT_EQ(Ids(blocked), (std::vector<int>{0, 4, 5, 6, 3}));
+  ready.splice(ready.begin(), blocked, blocked.begin(), blocked.end(), 5);
+  EXPECT_EQ(Ids(ready), (std::vector<int>{0, 4, 5, 6, 3, 1, 2, 7}));
+  EXPECT_TRUE(blocked.empty());
+  ready.splice(ready.end(), ready, ready.begin(), ready.iterator_to(tasks[1]));
+  ready.splice(ready.begin(), ready, --ready.end());
+  EXPECT_EQ(Ids(ready), (std::vector<int>{3, 1, 2, 7, 0, 4, 5, 6}));
+  blocked.splice(blocked.end(), ready);
+  EXPECT_TRUE(ready.empty());
+  EXPECT_EQ(blocked.size(), 8);
+  ReadyList moved(std::move(blocked));
+  EXPECT_TRUE(blocked.empty());
+  EXPECT_EQ(Ids(moved), (std::vector<int>{3, 1, 2, 7, 0, 4, 5, 6}));
+}
+
+TEST(IntrusiveList, SortMergeReverseRemove) {
+  std::vector<Task> tasks;
+  for (int id : {5, 3, 9, 1, 3, 7, 2, 8}) tasks.emplace_back(id);
+  ReadyList first, second;
+  for (size_t i = 0; i < tasks.size(); ++i) {
+    (i < 5 ? first : second).push_back(tasks[i]);
+  }
+  first.sort();
+  second.sort();
+  EXPECT_EQ(Ids(first), (std::vector<int>{1, 3, 3, 5, 9}));
+  // стабильность: из равных первым остаётся tasks[1]
+  EXPECT_EQ(&*++first.begin(), &tasks[1]);
+  first.merge(second);
+  EXPECT_TRUE(second.empty());
+  EXPECT_EQ(Ids(first), (std::vector<int>{1, 2, 3, 3, 5, 7, 8, 9}));
+  first.reverse();
+  EXPECT_EQ(Ids(first), (std::vector<int>{9, 8, 7, 5, 3, 3, 2, 1}));
+  first.sort([](const Task& a, const Task& b) { return a.id % 3 < b.id % 3; });
+  EXPECT_EQ(Ids(first), (std::vector<int>{9, 3, 3, 7, 1, 8, 5, 2}));
+  EXPECT_EQ(first.remove_if([](const Task& task) { return task.id < 4; }), 4);
+  EXPECT_EQ(Ids(first), (std::vector<int>{9, 7, 8, 5}));
+  first.clear();
+  EXPECT_TRUE(first.empty());
+  for (const Task& task : tasks) EXPECT_EQ(task.ready.pNext_, nullptr);
+}
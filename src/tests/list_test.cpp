@@ -1,7 +1,13 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <iostream>
 #include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "../lib/s21_list.h"
 
@@ -256,6 +262,74 @@ TEST(Erase, Last) {
   EXPECT_EQ(list.size(), 3);
 }
 
+TEST(Erase, ReturnsNextAndKeepsLinks) {
+  s21::list<int> list = {1, 2, 3, 4};
+  s21::list<int>::iterator it = list.begin();
+  ++it;
+  it = list.erase(it);
+  EXPECT_EQ(*it, 3);
+  it = list.erase(++it);
+  EXPECT_TRUE(it == list.end());
+  EXPECT_EQ(list.back(), 3);
+  it = list.erase(list.begin());
+  EXPECT_EQ(*it, 3);
+  it = list.erase(it);
+  EXPECT_TRUE(it == list.end());
+  EXPECT_TRUE(list.empty());
+  list.push_back(5);
+  EXPECT_EQ(list.front(), 5);
+  EXPECT_EQ(list.size(), 1);
+}
+
+TEST(Erase, Range) {
+  s21::list<int> list = {1, 2, 3, 4, 5, 6};
+  s21::list<int>::iterator first = list.begin();
+  ++first;
+  s21::list<int>::iterator last = first;
+  ++last;
+  ++last;
+  ++last;
+  s21::list<int>::iterator it = list.erase(first, last);
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(list.size(), 3);
+  EXPECT_EQ(list[1], 5);
+  EXPECT_TRUE(list.erase(it, it) == it);
+  EXPECT_EQ(list.size(), 3);
+  // хвост, затем всё оставшееся
+  list.erase(it, list.end());
+  EXPECT_EQ(list.back(), 1);
+  list.erase(list.begin(), list.end());
+  EXPECT_TRUE(list.empty());
+  list.push_front(7);
+  EXPECT_EQ(list.back(), 7);
+}
+
+TEST(Erase, SavedIteratorsMatchStdList) {
+  s21::list<int> list;
+  std::list<int> expected;
+  std::vector<s21::list<int>::iterator> saved;
+  std::vector<std::list<int>::iterator> expected_saved;
+  for (int i = 0; i < 200; ++i) {
+    list.push_back(i);
+    expected.push_back(i);
+    saved.push_back(--list.end());
+    expected_saved.push_back(--expected.end());
+  }
+  for (int i = 0; i < 200; i += 3) {
+    list.insert(saved[i], -i);
+    expected.insert(expected_saved[i], -i);
+  }
+  for (int i = 0; i < 200; i += 7) {
+    list.erase(saved[(i * 13) % 200]);
+    expected.erase(expected_saved[(i * 13) % 200]);
+  }
+  ASSERT_EQ(list.size(), expected.size());
+  auto it = list.end();
+  for (auto back = expected.rbegin(); back != expected.rend(); ++back) {
+    EXPECT_EQ(*--it, *back);
+  }
+}
+
 // Тестирование доступа к первому элементу непустого списка
 TEST(ListFrontBack, AccessFirstElement) {
   s21::list<int> myList{1, 2, 3, 4, 5};
@@ -471,6 +545,67 @@ TEST(ListSplice, SpliceItself) {
   EXPECT_EQ(*it, 3);
 }
 
+// обход вперёд и назад, чтобы проверить и pNext_, и pPrev_
+static void ExpectListEq(s21::list<int>& list, std::vector<int> expected) {
+  ASSERT_EQ(list.size(), expected.size());
+  auto it = list.begin();
+  for (int value : expected) EXPECT_EQ(*it++, value);
+  EXPECT_TRUE(it == list.end());
+  for (size_t i = expected.size(); i-- > 0;) EXPECT_EQ(*--it, expected[i]);
+}
+
+TEST(ListSplice, AppendKeepsBackLinks) {
+  s21::list<int> list = {1, 2};
+  s21::list<int> other = {3, 4, 5};
+  list.splice(list.end(), other);
+  ExpectListEq(list, {1, 2, 3, 4, 5});
+  EXPECT_TRUE(other.empty());
+  list.erase(++++list.begin());
+  ExpectListEq(list, {1, 2, 4, 5});
+}
+
+TEST(ListSplice, SingleElement) {
+  s21::list<int> ready = {1, 2, 3, 4};
+  s21::list<int> blocked = {10};
+  const int* address = &*++ready.begin();
+  blocked.splice(blocked.begin(), ready, ++ready.begin());
+  ExpectListEq(ready, {1, 3, 4});
+  ExpectListEq(blocked, {2, 10});
+  EXPECT_EQ(&*blocked.begin(), address);
+  blocked.splice(blocked.end(), ready, --ready.end());
+  blocked.splice(blocked.end(), ready, ready.begin());
+  ExpectListEq(ready, {3});
+  ExpectListEq(blocked, {2, 10, 4, 1});
+  ready.splice(ready.end(), blocked, blocked.begin());
+  ready.splice(ready.begin(), ready, --ready.end());
+  ready.splice(ready.begin(), ready, ready.begin());
+  ready.splice(ready.end(), ready, ready.end());
+  ExpectListEq(ready, {2, 3});
+  s21::list<int> empty;
+  empty.splice(empty.end(), ready, ready.begin());
+  ExpectListEq(empty, {2});
+}
+
+TEST(ListSplice, Range) {
+  s21::list<int> list = {1, 2, 3, 4, 5, 6};
+  s21::list<int> other = {10, 20};
+  auto first = ++list.begin();
+  auto last = first;
+  for (int i = 0; i < 3; ++i) ++last;
+  other.splice(++other.begin(), list, first, last);
+  ExpectListEq(list, {1, 5, 6});
+  ExpectListEq(other, {10, 2, 3, 4, 20});
+  other.splice(other.end(), list, ++list.begin(), list.end(), 2);
+  ExpectListEq(list, {1});
+  ExpectListEq(other, {10, 2, 3, 4, 20, 5, 6});
+  list.splice(list.begin(), other, other.begin(), other.begin());
+  other.splice(other.begin(), other, ++other.begin(), other.end());
+  ExpectListEq(other, {2, 3, 4, 20, 5, 6, 10});
+  list.splice(list.end(), other, other.begin(), other.end());
+  ExpectListEq(list, {1, 2, 3, 4, 20, 5, 6, 10});
+  EXPECT_TRUE(other.empty());
+}
+
 TEST(ListReverse, HandleEmptyList) {
   s21::list<int> emptyList;
   emptyList.reverse();
@@ -542,6 +677,38 @@ TEST(ListUnique, NoDuplicates) {
   EXPECT_EQ(i, 5);
 }
 
+TEST(ListUnique, PredicateAndCount) {
+  s21::list<int> list = {1, 2, 4, 3, 7, 8, 10, 11, 11};
+  // дубликат - тот, что отличается от оставленного меньше чем на 2
+  EXPECT_EQ(list.unique([](int kept, int x) { return x - kept < 2; }), 5);
+  std::vector<int> expected = {1, 4, 7, 10};
+  std::vector<int> actual;
+  for (auto it = list.begin(); it != list.end(); ++it) actual.push_back(*it);
+  EXPECT_EQ(actual, expected);
+  EXPECT_EQ(list.back(), 10);
+  EXPECT_EQ(*--list.end(), 10);
+  EXPECT_EQ(list.unique(), 0);
+}
+
+TEST(ListRemove, ValueAndPredicate) {
+  s21::list<int> list = {5, 1, 5, 2, 5, 3, 5};
+  // ссылка на элемент самого листа
+  EXPECT_EQ(list.remove(list.front()), 4);
+  EXPECT_EQ(list.size(), 3);
+  EXPECT_EQ(list.front(), 1);
+  EXPECT_EQ(list.back(), 3);
+  EXPECT_EQ(list.remove(9), 0);
+  EXPECT_EQ(list.remove_if([](int x) { return x % 2 == 1; }), 2);
+  EXPECT_EQ(list.front(), 2);
+  EXPECT_EQ(list.back(), 2);
+  EXPECT_EQ(list.remove_if([](int) { return true; }), 1);
+  EXPECT_TRUE(list.empty());
+  list.push_back(6);
+  list.push_front(4);
+  EXPECT_EQ(*--list.end(), 6);
+  EXPECT_EQ(list.size(), 2);
+}
+
 TEST(ListSort, SortEmptyList) {
   s21::list<int> list;
   list.sort();
@@ -595,6 +762,33 @@ TEST(ListSort, SortReverseOrder) {
   EXPECT_EQ(actual, expected);
 }
 
+// устойчивость и компаратор: равные ключи сохраняют исходный порядок
+TEST(ListSort, StableWithComparator) {
+  s21::list<std::pair<int, int>> list;
+  std::list<std::pair<int, int>> expected;
+  for (int i = 0; i < 1000; ++i) {
+    list.push_back({(i * 37) % 11, i});
+    expected.push_back({(i * 37) % 11, i});
+  }
+  auto by_key = [](const std::pair<int, int>& a,
+                   const std::pair<int, int>& b) { return a.first > b.first; };
+  list.sort(by_key);
+  expected.sort(by_key);
+  ASSERT_EQ(list.size(), expected.size());
+  auto it = list.begin();
+  for (const auto& item : expected) {
+    EXPECT_EQ(*it, item);
+    ++it;
+  }
+  // обратные ссылки тоже перепривязаны
+  it = list.end();
+  for (auto back = expected.rbegin(); back != expected.rend(); ++back) {
+    EXPECT_EQ(*--it, *back);
+  }
+  list.push_back({-1, -1});
+  EXPECT_EQ(list.back().first, -1);
+}
+
 TEST(List, Merge) {
   s21::list<int> our_list_first = {1};
   s21::list<int> our_list_second = {2, 3, 4, 5};
@@ -631,6 +825,64 @@ TEST(List, Merge3) {
   EXPECT_EQ(our_list_second.empty(), std_list_second.empty());
 }
 
+TEST(List, MergeStableWithComparator) {
+  using Item = std::pair<int, int>;
+  auto by_key = [](const Item& a, const Item& b) { return a.first < b.first; };
+  s21::list<Item> our_first, our_second;
+  std::list<Item> std_first, std_second;
+  for (int i = 0; i < 300; ++i) {
+    Item item = {i / 3, i};
+    Item other = {i / 2 + 50, -i};
+    our_first.push_back(item);
+    std_first.push_back(item);
+    our_second.push_back(other);
+    std_second.push_back(other);
+  }
+  our_first.merge(our_second, by_key);
+  std_first.merge(std_second, by_key);
+  EXPECT_TRUE(our_second.empty());
+  ASSERT_EQ(our_first.size(), std_first.size());
+  auto it = our_first.begin();
+  for (const auto& item : std_first) {
+    EXPECT_EQ(*it, item);
+    ++it;
+  }
+  it = our_first.end();
+  for (auto back = std_first.rbegin(); back != std_first.rend(); ++back) {
+    EXPECT_EQ(*--it, *back);
+  }
+  // слияние в пустой лист и пустого листа
+  s21::list<Item> empty;
+  empty.merge(our_first, by_key);
+  EXPECT_EQ(empty.size(), 600);
+  EXPECT_TRUE(our_first.empty());
+  empty.merge(our_first, by_key);
+  EXPECT_EQ(empty.back(), std_first.back());
+}
+
+// узлы переходят из пула другого листа, который уничтожается раньше
+TEST(ListAllocator, SpliceAndMergeOutliveOther) {
+  s21::list<std::string> list = {"b", "d"};
+  {
+    s21::list<std::string> other = {"a", "c"};
+    list.merge(other);
+    s21::list<std::string> tail = {"x", "y"};
+    list.splice(list.end(), tail);
+  }
+  list.pop_front();
+  list.push_back("z");
+  std::vector<std::string> actual;
+  for (auto it = list.begin(); it != list.end(); ++it) actual.push_back(*it);
+  EXPECT_EQ(actual,
+            (std::vector<std::string>{"b", "c", "d", "x", "y", "z"}));
+  s21::list<int, std::allocator<int>> plain = {3, 1, 2};
+  s21::list<int, std::allocator<int>> other = {0};
+  plain.sort();
+  plain.merge(other);
+  EXPECT_EQ(plain.front(), 0);
+  EXPECT_EQ(plain.size(), 4);
+}
+
 TEST(List, Insert_Many_first) {
   s21::list<int> our_list = {1, 2, 3, 4, 5};
   s21::list<int>::iterator our_it = our_list.begin();
@@ -701,4 +953,122 @@ TEST(List, Insert_Many_empty) {
   EXPECT_EQ(*new_it, 8);
   ++new_it;
   EXPECT_EQ(*new_it, 9);
+}
+// элемент, который считает свои копии
+struct Counted {
+  static int copies;
+  int a;
+  std::string b;
+  Counted(int a, std::string b) : a(a), b(std::move(b)) {}
+  Counted(const Counted& other) : a(other.a), b(other.b) { ++copies; }
+  Counted(Counted&&) = default;
+};
+int Counted::copies = 0;
+
+TEST(ListMove, EmplaceAndRvaluesDoNotCopy) {
+  Counted::copies = 0;
+  s21::list<Counted> list;
+  list.emplace_back(2, "b");
+  list.emplace_front(1, "a");
+  list.push_back(Counted(4, "d"));
+  auto it = list.emplace(--list.end(), 3, "c");
+  EXPECT_EQ((*it).a, 3);
+  list.insert(list.begin(), Counted(0, ""));
+  list.insert_many_back(Counted(5, "e"), Counted(6, "f"));
+  EXPECT_EQ(Counted::copies, 0);
+  EXPECT_EQ(list.size(), 7);
+  int expected = 0;
+  for (auto item = list.begin(); item != list.end(); ++item, ++expected) {
+    EXPECT_EQ((*item).a, expected);
+  }
+  Counted copy(1, "x");
+  list.push_back(copy);
+  EXPECT_EQ(Counted::copies, 1);
+}
+
+TEST(ListMove, MoveOnlyElements) {
+  s21::list<std::unique_ptr<int>> list;
+  list.push_back(std::make_unique<int>(2));
+  list.emplace_front(new int(1));
+  list.insert_many(list.end(), std::make_unique<int>(3),
+                   std::make_unique<int>(4));
+  EXPECT_EQ(list.size(), 4);
+  EXPECT_EQ(*list.front(), 1);
+  EXPECT_EQ(*list.back(), 4);
+  std::unique_ptr<int> taken = std::move(list.front());
+  list.pop_front();
+  EXPECT_EQ(*taken, 1);
+  list.remove_if([](const std::unique_ptr<int>& p) { return *p % 2 == 1; });
+  EXPECT_EQ(list.size(), 2);
+}
+
+TEST(ListIndex, MatchesAfterEveryChange) {
+  s21::list<int> list;
+  std::vector<int> expected;
+  auto check = [&]() {
+    ASSERT_EQ(list.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(list[i], expected[i]);
+    }
+    for (size_t i = expected.size(); i-- > 0;) EXPECT_EQ(list[i], expected[i]);
+  };
+  for (int i = 0; i < 100; ++i) {
+    list.push_back(i);
+    expected.push_back(i);
+  }
+  check();
+  EXPECT_EQ(list[50], 50);
+  list.insert(list.begin(), -1);
+  expected.insert(expected.begin(), -1);
+  EXPECT_EQ(list[50], 49);
+  list.pop_front();
+  list.pop_back();
+  expected.erase(expected.begin());
+  expected.pop_back();
+  check();
+  EXPECT_EQ(list[10], 10);
+  list.erase(++list.begin());
+  expected.erase(expected.begin() + 1);
+  check();
+  list.push_back(500);
+  expected.push_back(500);
+  check();
+  list.reverse();
+  std::reverse(expected.begin(), expected.end());
+  check();
+  list.sort();
+  std::sort(expected.begin(), expected.end());
+  check();
+  list.remove_if([](int value) { return value % 3 == 0; });
+  expected.erase(std::remove_if(expected.begin(), expected.end(),
+                                [](int value) { return value % 3 == 0; }),
+                 expected.end());
+  check();
+}
+
+TEST(ListIndex, IndexedRandomAccess) {
+  s21::list<int> list;
+  std::vector<int> expected;
+  list.set_indexed(true);
+  EXPECT_TRUE(list.indexed());
+  for (int i = 0; i < 1000; ++i) {
+    list.push_front(i);
+    expected.insert(expected.begin(), i);
+  }
+  std::mt19937 rng(48);
+  for (int i = 0; i < 2000; ++i) {
+    size_t index = rng() % expected.size();
+    EXPECT_EQ(list[index], expected[index]);
+  }
+  s21::list<int> other = {-1, -2, -3};
+  list.splice(list.begin(), other);
+  expected.insert(expected.begin(), {-1, -2, -3});
+  for (int i = 0; i < 10; ++i) list.push_back(2000 + i);
+  for (int i = 0; i < 10; ++i) expected.push_back(2000 + i);
+  for (int i = 0; i < 2000; ++i) {
+    size_t index = rng() % expected.size();
+    EXPECT_EQ(list[index], expected[index]);
+  }
+  list.set_indexed(false);
+  EXPECT_EQ(list[700], expected[700]);
 }
\ No newline at end of file
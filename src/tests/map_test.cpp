@@ -1,8 +1,11 @@
 #include <gtest/gtest.h>
 
 #include <iterator>
+#include <limits>
 #include <map>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "../lib/s21_map.h"
@@ -465,4 +468,170 @@ TEST(MapInsertOrAssign, MultipleOperations) {
   EXPECT_EQ(map[1], "one");
   EXPECT_EQ(map[2], "dos");
   EXPECT_EQ(map[3], "three");
-}
\ No newline at end of file
+}
+
+TEST(MapFindMany, SmallBatch) {
+  s21::map<int, std::string> map = {{1, "one"}, {3, "three"}, {5, "five"}};
+  int keys[] = {5, 2, 1, 7, 3};
+  std::vector<s21::map<int, std::string>::iterator> out(5, map.end());
+  map.find_many(keys, 5, out.data());
+
+  EXPECT_EQ(out[0]->second, "five");
+  EXPECT_TRUE(out[1] == map.end());
+  EXPECT_EQ(out[2]->second, "one");
+  EXPECT_TRUE(out[3] == map.end());
+  EXPECT_EQ(out[4]->second, "three");
+}
+
+TEST(MapFindMany, LargeUnsortedBatchMatchesFind) {
+  s21::map<int, int> map;
+  for (int i = 0; i < 2000; ++i) map.insert((i * 7919) % 4000, i);
+  std::vector<int> keys;
+  for (int i = 0; i < 1024; ++i) keys.push_back((i * 104729) % 4100);
+  std::vector<s21::map<int, int>::iterator> out(keys.size(), map.end());
+  map.find_many(keys.data(), keys.size(), out.data());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_TRUE(out[i] == map.find(keys[i]));
+  }
+}
+
+TEST(MapContainsMany, Bitmap) {
+  s21::map<int, int> map;
+  for (int i = 0; i < 300; i += 3) map.insert(i, i);
+  std::vector<int> keys;
+  for (int i = 0; i < 200; ++i) keys.push_back(i);
+  std::vector<uint64_t> bitmap((keys.size() + 63) / 64, ~uint64_t{0});
+  map.contains_many(keys.data(), keys.size(), bitmap.data());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    bool bit = (bitmap[i / 64] >> (i % 64)) & 1;
+    EXPECT_EQ(bit, map.contains(keys[i]));
+  }
+  // bits past the batch are cleared as well
+  EXPECT_EQ(bitmap.back() >> (keys.size() % 64), 0);
+
+  s21::map<int, int> empty;
+  empty.contains_many(keys.data(), keys.size(), bitmap.data());
+  for (uint64_t word : bitmap) EXPECT_EQ(word, 0);
+}
+
+TEST(MapSplay, FindAndEraseKeepOrder) {
+  s21::map<int, int> map(s21::map<int, int>::SPLAY);
+  for (int i = 0; i < 200; ++i) map[(i * 7) % 200] = i;
+  EXPECT_EQ(map.find(42).getNode()->parent, nullptr);
+  EXPECT_EQ(map.at(42), 6);
+  EXPECT_THROW(map.at(500), std::out_of_range);
+  for (int key = 0; key < 200; key += 2) map.erase(map.find(key));
+  int expected = 1;
+  for (auto it = map.begin(); it != map.end(); ++it, expected += 2) {
+    EXPECT_EQ((*it).first, expected);
+  }
+  EXPECT_EQ(expected, 201);
+}
+
+// aggregate(lo, hi) of every range against a scan of std::map
+template <typename Monoid, typename Map>
+static void ExpectAggregates(Map& map, const std::map<int, int>& expected) {
+  Monoid monoid;
+  for (int lo = -2; lo < 42; lo += 3) {
+    for (int hi = lo; hi < 44; hi += 5) {
+      auto value = monoid.identity();
+      for (auto it = expected.lower_bound(lo);
+           it != expected.end() && it->first < hi; ++it) {
+        value = monoid.combine(value, monoid(it->second));
+      }
+      EXPECT_EQ(map.aggregate(lo, hi), value) << lo << " " << hi;
+    }
+  }
+}
+
+TEST(MapAggregate, SumMinMaxCountUnderUpdates) {
+  s21::map<int, int, s21::Sum<int>> sum;
+  using MinMap = s21::map<int, int, s21::Min<int>>;
+  MinMap min(MinMap::SPLAY);
+  s21::map<int, int, s21::Max<int>> max;
+  using CountMap = s21::map<int, int, s21::Count>;
+  CountMap count(CountMap::SPLAY);
+  std::map<int, int> expected;
+  for (int i = 0; i < 120; ++i) {
+    int key = (i * 17) % 40;
+    int value = (i * 31) % 23 - 11;
+    if (i % 4 == 3) {
+      auto it = sum.find(key);
+      if (it != sum.end()) sum.erase(it);
+      auto min_it = min.find(key);
+      if (min_it != min.end()) min.erase(min_it);
+      auto max_it = max.find(key);
+      if (max_it != max.end()) max.erase(max_it);
+      auto count_it = count.find(key);
+      if (count_it != count.end()) count.erase(count_it);
+      expected.erase(key);
+    } else {
+      sum.insert_or_assign(key, value);
+      min.insert_or_assign(key, value);
+      max.insert_or_assign(key, value);
+      count.insert_or_assign(key, value);
+      expected[key] = value;
+    }
+  }
+  ExpectAggregates<s21::Sum<int>>(sum, expected);
+  ExpectAggregates<s21::Min<int>>(min, expected);
+  ExpectAggregates<s21::Max<int>>(max, expected);
+  ExpectAggregates<s21::Count>(count, expected);
+  EXPECT_EQ(count.aggregate(), expected.size());
+  EXPECT_EQ(sum.aggregate(10, 10), 0);
+  EXPECT_EQ(max.aggregate(100, 200), std::numeric_limits<int>::lowest());
+}
+
+TEST(MapAggregate, UpdateKeepsAggregates) {
+  using SumMap = s21::map<int, int, s21::Sum<int>>;
+  static_assert(std::is_same_v<decltype(std::declval<SumMap&>()[0]),
+                               const int&>);
+  static_assert(std::is_same_v<decltype(*std::declval<SumMap::iterator>()),
+                               const std::pair<int, int>&>);
+  static_assert(
+      std::is_same_v<decltype(std::declval<s21::map<int, int>&>().at(0)),
+                     int&>);
+  SumMap map(SumMap::SPLAY);
+  std::map<int, int> expected;
+  for (int key = 0; key < 40; ++key) {
+    map.insert(key, key);
+    expected[key] = key;
+  }
+  for (int key = 0; key < 40; key += 3) {
+    map.update(key, -key);
+    expected[key] = -key;
+  }
+  EXPECT_EQ(map.at(3), -3);
+  EXPECT_EQ(map[4], 4);
+  ExpectAggregates<s21::Sum<int>>(map, expected);
+  EXPECT_THROW(map.update(100, 1), std::out_of_range);
+}
+
+TEST(MapAggregate, KeptByCopyCompactAndBuild) {
+  s21::map<int, int, s21::Sum<int>> map;
+  std::map<int, int> expected;
+  for (int key = 0; key < 40; ++key) {
+    map.insert((key * 7) % 40, key);
+    expected[(key * 7) % 40] = key;
+  }
+  s21::map<int, int, s21::Sum<int>> copy(map);
+  ExpectAggregates<s21::Sum<int>>(copy, expected);
+  map.compact();
+  ExpectAggregates<s21::Sum<int>>(map, expected);
+
+  std::vector<std::pair<int, int>> sorted(expected.begin(), expected.end());
+  s21::map<int, int, s21::Sum<int>> built;
+  built.build_sorted(sorted.begin(), sorted.size());
+  ExpectAggregates<s21::Sum<int>>(built, expected);
+}
+
+TEST(mapInsert, MappedValuesWithoutOrdering) {
+  // s21::vector has no operator<, map compares keys only
+  s21::map<int, s21::vector<int>> map;
+  map[2].push_back(20);
+  map[1].push_back(10);
+  map[2].push_back(21);
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.at(2).size(), 2);
+  EXPECT_EQ((*map.begin()).first, 1);
+}
@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+#include "../lib/s21_mapped_map.h"
+
+struct Quote {
+  double price;
+  int32_t volume;
+};
+
+// Tree instantiates its default comparator for the whole stored pair
+bool operator<(const Quote& a, const Quote& b) { return a.price < b.price; }
+
+TEST(mappedMap, WriteAndLookup) {
+  s21::map<uint64_t, Quote> map;
+  for (uint64_t i = 0; i < 100; ++i) {
+    map.insert(i * 2, Quote{i * 1.5, static_cast<int32_t>(i)});
+  }
+  std::string path = testing::TempDir() + "s21_map_basic.img";
+  s21::mapped_map<uint64_t, Quote>::write(path, map);
+
+  s21::mapped_map<uint64_t, Quote> image(path);
+  EXPECT_EQ(image.size(), 100);
+  EXPECT_TRUE(image.contains(42));
+  EXPECT_FALSE(image.contains(43));
+  EXPECT_EQ(image.at(42).volume, 21);
+  EXPECT_DOUBLE_EQ(image[42].price, 31.5);
+  EXPECT_THROW(image.at(43), std::out_of_range);
+  EXPECT_EQ(image.lower_bound(43)->first, 44);
+  EXPECT_EQ(image.upper_bound(44)->first, 46);
+  EXPECT_TRUE(image.find(1000) == image.end());
+
+  uint64_t expected = 0;
+  for (auto it = image.begin(); it != image.end(); ++it, expected += 2) {
+    EXPECT_EQ(it->first, expected);
+  }
+}
+
+TEST(mappedMap, WriteFromSortedRange) {
+  std::vector<std::pair<int, int>> items = {{1, 10}, {2, 20}, {3, 30}};
+  std::string path = testing::TempDir() + "s21_map_range.img";
+  s21::mapped_map<int, int>::write(path, items.begin(), items.end());
+  s21::mapped_map<int, int> image;
+  EXPECT_FALSE(image.is_open());
+  image.open(path);
+  EXPECT_EQ(image.size(), 3);
+  EXPECT_EQ(image.at(3), 30);
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include "../lib/s21_mapped_set.h"
+
+static std::string image_path(const std::string& name) {
+  return testing::TempDir() + "s21_" + name + ".img";
+}
+
+TEST(mappedSet, WriteAndOpen) {
+  s21::set<uint64_t> set = {5, 1, 9, 3, 7};
+  std::string path = image_path("set_basic");
+  s21::mapped_set<uint64_t>::write(path, set);
+
+  s21::mapped_set<uint64_t> image(path);
+  EXPECT_TRUE(image.is_open());
+  EXPECT_EQ(image.size(), 5);
+  auto it = image.begin();
+  for (auto sit = set.begin(); sit != set.end(); ++sit, ++it) {
+    EXPECT_EQ(*it, *sit);
+  }
+  EXPECT_TRUE(it == image.end());
+}
+
+TEST(mappedSet, Lookups) {
+  s21::set<int> set = {10, 20, 30, 40};
+  std::string path = image_path("set_lookup");
+  s21::mapped_set<int>::write(path, set);
+  s21::mapped_set<int> image(path);
+
+  EXPECT_TRUE(image.contains(20));
+  EXPECT_FALSE(image.contains(25));
+  EXPECT_EQ(*image.find(30), 30);
+  EXPECT_TRUE(image.find(5) == image.end());
+  EXPECT_EQ(*image.lower_bound(25), 30);
+  EXPECT_EQ(*image.lower_bound(30), 30);
+  EXPECT_EQ(*image.upper_bound(30), 40);
+  EXPECT_TRUE(image.lower_bound(41) == image.end());
+  EXPECT_TRUE(image.upper_bound(40) == image.end());
+  EXPECT_EQ(*image.lower_bound(0), 10);
+}
+
+TEST(mappedSet, EmptyImage) {
+  s21::set<int> set;
+  std::string path = image_path("set_empty");
+  s21::mapped_set<int>::write(path, set);
+  s21::mapped_set<int> image(path);
+  EXPECT_TRUE(image.empty());
+  EXPECT_FALSE(image.contains(1));
+  EXPECT_TRUE(image.begin() == image.end());
+}
+
+TEST(mappedSet, MoveAndClose) {
+  s21::set<int> set = {1, 2, 3};
+  std::string path = image_path("set_move");
+  s21::mapped_set<int>::write(path, set);
+  s21::mapped_set<int> image(path);
+  s21::mapped_set<int> moved(std::move(image));
+  EXPECT_FALSE(image.is_open());
+  EXPECT_EQ(moved.size(), 3);
+  moved.close();
+  EXPECT_FALSE(moved.is_open());
+  EXPECT_TRUE(moved.empty());
+}
+
+TEST(mappedSet, RewriteKeepsOpenImage) {
+  std::string path = image_path("set_rewrite");
+  s21::set<int> before = {1, 2, 3};
+  s21::mapped_set<int>::write(path, before);
+  s21::mapped_set<int> old_image(path);
+  s21::set<int> after;
+  for (int i = 100; i < 5000; ++i) after.insert(i);
+  s21::mapped_set<int>::write(path, after);
+  // the open image still maps the old file
+  EXPECT_EQ(old_image.size(), 3);
+  EXPECT_TRUE(old_image.contains(2));
+  EXPECT_FALSE(old_image.contains(100));
+  s21::mapped_set<int> new_image(path);
+  EXPECT_EQ(new_image.size(), 4900);
+  EXPECT_TRUE(new_image.contains(4999));
+}
+
+TEST(mappedSet, InvalidFiles) {
+  EXPECT_THROW(s21::mapped_set<int>(image_path("missing_file")),
+               std::runtime_error);
+
+  std::string path = image_path("set_garbage");
+  {
+    std::ofstream out(path, std::ios::binary);
+    out << "definitely not an image file";
+  }
+  EXPECT_THROW(s21::mapped_set<int>{path}, std::runtime_error);
+
+  // entry size mismatch
+  s21::set<int> set = {1, 2};
+  path = image_path("set_int");
+  s21::mapped_set<int>::write(path, set);
+  EXPECT_THROW(s21::mapped_set<int64_t>{path}, std::runtime_error);
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../lib/s21_multimap.h"
+
+TEST(MultimapTest, EqualKeysKeepInsertionOrder) {
+  s21::multimap<int, std::string> map;
+  map.insert(2, "b1");
+  map.insert(1, "a");
+  map.insert(2, "b2");
+  map.insert(3, "c");
+  map.insert(2, "b3");
+  EXPECT_EQ(map.size(), 5);
+  EXPECT_EQ(map.count(2), 3);
+  EXPECT_EQ(map.count(4), 0);
+  auto range = map.equal_range(2);
+  std::vector<std::string> values;
+  for (auto it = range.first; it != range.second; ++it) {
+    values.push_back((*it).second);
+  }
+  EXPECT_EQ(values, (std::vector<std::string>{"b1", "b2", "b3"}));
+  EXPECT_EQ((*map.lower_bound(2)).second, "b1");
+  EXPECT_EQ((*map.upper_bound(2)).second, "c");
+  EXPECT_TRUE(map.upper_bound(3) == map.end());
+  EXPECT_EQ((*map.find(2)).second, "b1");
+  EXPECT_TRUE(map.find(0) == map.end());
+}
+
+TEST(MultimapTest, HintedInsert) {
+  s21::multimap<int, int> map;
+  // in key order at the end
+  for (int i = 0; i < 100; ++i) map.insert(map.end(), {i / 4, i});
+  EXPECT_EQ(map.size(), 100);
+  int expected = 0;
+  for (auto it = map.begin(); it != map.end(); ++it, ++expected) {
+    EXPECT_EQ((*it).first, expected / 4);
+    EXPECT_EQ((*it).second, expected);
+  }
+  // a good hint goes right before it, a bad one falls back to insert
+  auto hint = map.lower_bound(10);
+  auto placed = map.insert(hint, {10, -1});
+  EXPECT_EQ((*map.lower_bound(10)).second, -1);
+  EXPECT_TRUE(++placed == hint);
+  map.insert(map.begin(), {50, -2});
+  EXPECT_EQ((*--map.end()).second, -2);
+  EXPECT_EQ(map.count(10), 5);
+}
+
+TEST(MultimapTest, EraseKeyAndMerge) {
+  s21::multimap<int, int> map = {{1, 1}, {2, 2}, {2, 3}, {3, 4}, {2, 5}};
+  EXPECT_EQ(map.erase(2), 3);
+  EXPECT_EQ(map.erase(2), 0);
+  EXPECT_EQ(map.size(), 2);
+  s21::multimap<int, int> other = {{1, 6}, {4, 7}};
+  map.merge(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(map.count(1), 2);
+  EXPECT_TRUE(map.contains(4));
+}
+
+TEST(MultimapTest, ScapegoatMatchesStdMultimap) {
+  s21::multimap<int, int> map(s21::multimap<int, int>::SCAPEGOAT);
+  std::multimap<int, int> expected;
+  for (int i = 0; i < 1000; ++i) {
+    map.insert(i % 13, i);
+    expected.insert({i % 13, i});
+  }
+  for (int key = 0; key < 13; key += 3) {
+    map.erase(key);
+    expected.erase(key);
+  }
+  ASSERT_EQ(map.size(), expected.size());
+  auto it = map.begin();
+  for (const auto& item : expected) {
+    EXPECT_EQ((*it).first, item.first);
+    EXPECT_EQ((*it).second, item.second);
+    ++it;
+  }
+}
+
+TEST(GroupedMultimapTest, ValuesOfAKeyAreContiguous) {
+  s21::grouped_multimap<int, std::string, 2> map;
+  for (int i = 0; i < 10; ++i) map.insert(i % 3, std::to_string(i));
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(map.value_count(), 10);
+  EXPECT_EQ(map.count(0), 4);
+  auto range = map.equal_range(0);
+  ASSERT_EQ(range.second - range.first, 4);
+  EXPECT_EQ(range.first[0], "0");
+  EXPECT_EQ(range.first[3], "9");
+  EXPECT_EQ(map.equal_range(5).first, nullptr);
+  EXPECT_EQ((*map.upper_bound(0)).first, 1);
+  EXPECT_EQ((*map.lower_bound(1)).first, 1);
+  (*map.find(1)).second.erase(0);
+  EXPECT_EQ(map.count(1), 2);
+  EXPECT_EQ((*map.find(1)).second[0], "4");
+}
+
+TEST(GroupedMultimapTest, CompactKeepsGroups) {
+  s21::grouped_multimap<int, std::string, 2> map;
+  for (int i = 0; i < 60; ++i) map.insert(i % 12, std::to_string(i));
+  map.compact();
+  EXPECT_EQ(map.value_count(), 60);
+  auto range = map.equal_range(5);
+  ASSERT_EQ(range.second - range.first, 5);
+  EXPECT_EQ(range.first[0], "5");
+  EXPECT_EQ(range.first[4], "53");
+  EXPECT_EQ(map.erase(5), 5);
+  EXPECT_EQ(map.count(6), 5);
+}
+
+TEST(GroupedMultimapTest, EraseCopyAndMerge) {
+  s21::grouped_multimap<int, std::string> map;
+  for (int i = 0; i < 40; ++i) map.insert((i * 7) % 10, std::to_string(i));
+  s21::grouped_multimap<int, std::string> copy(map);
+  // erasing inner keys moves groups between nodes
+  for (int key = 0; key < 10; key += 2) EXPECT_EQ(map.erase(key), 4);
+  EXPECT_EQ(map.value_count(), 20);
+  EXPECT_EQ(copy.value_count(), 40);
+  map.merge(copy);
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(map.count(1), 8);
+  EXPECT_EQ(map.count(2), 4);
+}
@@ -2,6 +2,7 @@
 
 #include <iterator>
 #include <set>
+#include <vector>
 
 #include "../lib/s21_multiset.h"
 using namespace s21;
@@ -300,3 +301,53 @@ TEST(MultisetMerge, OverlappingSets) {
 
   EXPECT_TRUE(mset2.empty());
 }
+
+TEST(multisetTest, SplayKeepsDuplicatesTogether) {
+  s21::multiset<int> multiset(s21::multiset<int>::SPLAY);
+  std::multiset<int> expected;
+  for (int i = 0; i < 300; ++i) {
+    multiset.insert(i % 17);
+    expected.insert(i % 17);
+    multiset.find(i % 5);  // reshapes the tree
+  }
+  for (int key = 0; key < 17; ++key) {
+    EXPECT_EQ(multiset.count(key), expected.count(key));
+    auto range = multiset.equal_range(key);
+    size_t length = 0;
+    for (auto it = range.first; it != range.second; ++it) {
+      EXPECT_EQ(*it, key);
+      ++length;
+    }
+    EXPECT_EQ(length, expected.count(key));
+  }
+}
+
+TEST(multisetTest, ScapegoatKeepsDuplicatesTogether) {
+  s21::multiset<int> multiset(s21::multiset<int>::SCAPEGOAT);
+  std::multiset<int> expected;
+  for (int i = 0; i < 600; ++i) {
+    multiset.insert(i / 40);
+    expected.insert(i / 40);
+  }
+  for (int key = 0; key < 15; ++key) {
+    EXPECT_EQ(multiset.count(key), expected.count(key));
+    auto range = multiset.equal_range(key);
+    size_t length = 0;
+    for (auto it = range.first; it != range.second; ++it) ++length;
+    EXPECT_EQ(length, expected.count(key));
+  }
+}
+
+TEST(multisetTest, BuildSortedWithDuplicates) {
+  std::vector<int> items = {1, 2, 2, 2, 2, 2, 2, 3};
+  s21::multiset<int> multiset;
+  multiset.build_sorted(items.begin(), items.size());
+  EXPECT_EQ(multiset.size(), 8);
+  EXPECT_EQ(multiset.count(2), 6);
+  auto range = multiset.equal_range(2);
+  size_t length = 0;
+  for (auto it = range.first; it != range.second; ++it) ++length;
+  EXPECT_EQ(length, 6);
+  EXPECT_EQ(*multiset.lower_bound(2), 2);
+  EXPECT_EQ(*multiset.upper_bound(2), 3);
+}
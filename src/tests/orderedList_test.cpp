@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <memory>
+#include <set>
+#include <string>
 
 #include "../lib/s21_ordered_list.h"
 
@@ -122,3 +125,38 @@ TEST(OrderedListSwap, CorrectlySwapsContents) {
   EXPECT_EQ(list2[0], 1);
   EXPECT_EQ(list2[2], 3);
 }
+
+TEST(NodePool, RecyclesFreedNodes) {
+  s21::NodePool<double> pool;
+  double* first = pool.allocate(1);
+  double* second = pool.allocate(1);
+  EXPECT_NE(first, second);
+  pool.deallocate(first, 1);
+  EXPECT_EQ(pool.allocate(1), first);
+  // блоки растут: тысяча узлов без повторов
+  std::set<double*> seen = {first, second};
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_TRUE(seen.insert(pool.allocate(1)).second);
+  }
+  double* many = pool.allocate(3);
+  many[2] = 1.0;
+  pool.deallocate(many, 3);
+  // копия пула начинается пустой
+  s21::NodePool<double> copy(pool);
+  EXPECT_FALSE(copy == pool);
+  EXPECT_EQ(seen.count(copy.allocate(1)), 0);
+}
+
+TEST(OrderedListAllocator, MoveAssignKeepsNodesAlive) {
+  s21::orderedList<std::string> target = {"a"};
+  {
+    s21::orderedList<std::string> source = {"b", "c", "d"};
+    target = std::move(source);
+  }
+  EXPECT_EQ(target.size(), 3);
+  EXPECT_EQ(target[2], "d");
+  s21::orderedList<std::string, std::allocator<std::string>> plain = {"e"};
+  s21::orderedList<std::string, std::allocator<std::string>> other(plain);
+  plain.swap(other);
+  EXPECT_EQ(plain[0], "e");
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "../lib/s21_persistent_map.h"
+
+TEST(persistentMap, DefaultConstructor) {
+  s21::persistent_map<int, std::string> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.size(), 0);
+  EXPECT_TRUE(map.begin() == map.end());
+}
+
+TEST(persistentMap, InitializerListAndOrder) {
+  s21::persistent_map<int, std::string> map = {
+      {3, "three"}, {1, "one"}, {2, "two"}, {1, "uno"}};
+  EXPECT_EQ(map.size(), 3);
+  int expected = 1;
+  for (auto it = map.begin(); it != map.end(); ++it, ++expected) {
+    EXPECT_EQ((*it).first, expected);
+  }
+  EXPECT_EQ(map.at(1), "one");
+}
+
+TEST(persistentMap, InsertAndFind) {
+  s21::persistent_map<int, std::string> map;
+  auto res = map.insert(1, "one");
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ((*res.first).second, "one");
+  res = map.insert(std::make_pair(1, "uno"));
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(map.at(1), "one");
+  EXPECT_TRUE(map.contains(1));
+  EXPECT_FALSE(map.contains(2));
+  EXPECT_TRUE(map.find(2) == map.end());
+  EXPECT_THROW(map.at(2), std::out_of_range);
+}
+
+TEST(persistentMap, InsertOrAssign) {
+  s21::persistent_map<int, std::string> map;
+  map.insert(1, "one");
+  auto res = map.insert_or_assign(1, "uno");
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(map[1], "uno");
+  EXPECT_EQ(map.size(), 1);
+}
+
+TEST(persistentMap, SnapshotIsNotAffectedByUpdates) {
+  s21::persistent_map<int, int> map;
+  for (int i = 0; i < 100; ++i) map.insert(i, i);
+  s21::persistent_map<int, int> old(map);
+  EXPECT_EQ(map.use_count(), 2);
+
+  map.insert_or_assign(50, -50);
+  map.erase(10);
+  map.insert(1000, 1000);
+
+  EXPECT_EQ(old.size(), 100);
+  EXPECT_EQ(old.at(50), 50);
+  EXPECT_TRUE(old.contains(10));
+  EXPECT_FALSE(old.contains(1000));
+
+  EXPECT_EQ(map.size(), 100);
+  EXPECT_EQ(map.at(50), -50);
+  EXPECT_FALSE(map.contains(10));
+  EXPECT_TRUE(map.contains(1000));
+  EXPECT_EQ(old.use_count(), 1);
+}
+
+TEST(persistentMap, ManyVersions) {
+  std::vector<s21::persistent_map<int, int>> versions;
+  s21::persistent_map<int, int> map;
+  for (int i = 0; i < 200; ++i) {
+    map.insert((i * 37) % 200, i);
+    versions.push_back(map);
+  }
+  for (int v = 0; v < 200; ++v) {
+    EXPECT_EQ(versions[v].size(), static_cast<size_t>(v + 1));
+    EXPECT_EQ(versions[v].at((v * 37) % 200), v);
+  }
+}
+
+TEST(persistentMap, EraseMatchesStdMap) {
+  s21::persistent_map<int, int> map;
+  std::map<int, int> std_map;
+  for (int i = 0; i < 500; ++i) {
+    int key = (i * 7919) % 1000;
+    map.insert(key, i);
+    std_map.insert({key, i});
+  }
+  for (int i = 0; i < 1000; i += 3) {
+    EXPECT_EQ(map.erase(i), std_map.erase(i));
+  }
+  EXPECT_EQ(map.size(), std_map.size());
+  auto it = map.begin();
+  for (const auto& item : std_map) {
+    EXPECT_EQ((*it).first, item.first);
+    EXPECT_EQ((*it).second, item.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == map.end());
+}
+
+TEST(persistentMap, EraseIteratorOfAnotherVersion) {
+  using Map = s21::persistent_map<int, int>;
+  static_assert(std::is_same_v<decltype(*std::declval<Map::iterator>()),
+                               const Map::value_type&>);
+  Map map = {{1, 1}, {2, 2}, {3, 3}};
+  Map snapshot = map;
+  map.erase(2);
+  map.erase(snapshot.find(2));
+  EXPECT_EQ(map.size(), 2);
+  map.erase(snapshot.find(3));
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_TRUE(map.contains(1));
+  EXPECT_FALSE(map.contains(3));
+  EXPECT_EQ(snapshot.size(), 3);
+}
+
+TEST(persistentMap, IteratorDecrement) {
+  s21::persistent_map<int, int> map = {{1, 1}, {2, 2}, {3, 3}, {4, 4}};
+  auto it = map.end();
+  for (int expected = 4; expected > 0; --expected) {
+    --it;
+    EXPECT_EQ(it->first, expected);
+  }
+}
+
+TEST(persistentMap, MoveAndSwap) {
+  s21::persistent_map<int, int> map = {{1, 1}, {2, 2}};
+  s21::persistent_map<int, int> moved(std::move(map));
+  EXPECT_EQ(moved.size(), 2);
+  EXPECT_TRUE(map.empty());
+  s21::persistent_map<int, int> other = {{3, 3}};
+  moved.swap(other);
+  EXPECT_EQ(moved.size(), 1);
+  EXPECT_EQ(other.size(), 2);
+  other.clear();
+  EXPECT_TRUE(other.empty());
+}
+
+TEST(persistentMap, InsertMany) {
+  s21::persistent_map<int, int> map;
+  auto results =
+      map.insert_many(std::make_pair(1, 1), std::make_pair(2, 2),
+                      std::make_pair(1, 3));
+  EXPECT_EQ(results.size(), 3);
+  EXPECT_TRUE(results[0].second);
+  EXPECT_FALSE(results[2].second);
+  EXPECT_EQ(map.size(), 2);
+}
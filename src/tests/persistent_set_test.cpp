@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <set>
+
+#include "../lib/s21_persistent_set.h"
+
+TEST(persistentSet, InitializerListConstructor) {
+  s21::persistent_set<int> set = {5, 1, 3, 1};
+  EXPECT_EQ(set.size(), 3);
+  int expected[] = {1, 3, 5};
+  int i = 0;
+  for (auto it = set.begin(); it != set.end(); ++it) {
+    EXPECT_EQ(*it, expected[i++]);
+  }
+}
+
+TEST(persistentSet, InsertEraseContains) {
+  s21::persistent_set<int> set;
+  EXPECT_TRUE(set.insert(1).second);
+  EXPECT_FALSE(set.insert(1).second);
+  EXPECT_TRUE(set.contains(1));
+  EXPECT_EQ(set.erase(1), 1);
+  EXPECT_EQ(set.erase(1), 0);
+  EXPECT_TRUE(set.empty());
+}
+
+TEST(persistentSet, SequentialInsertKeepsVersions) {
+  s21::persistent_set<int> set;
+  s21::persistent_set<int> half;
+  for (int i = 0; i < 1000; ++i) {
+    if (i == 500) half = set;
+    set.insert(i);
+  }
+  EXPECT_EQ(half.size(), 500);
+  EXPECT_EQ(set.size(), 1000);
+  EXPECT_FALSE(half.contains(500));
+  EXPECT_TRUE(set.contains(999));
+
+  // iterators of a snapshot stay valid while the live version changes
+  s21::persistent_set<int> snapshot(half);
+  for (auto it = snapshot.begin(); it != snapshot.end(); ++it) {
+    half.erase(*it);
+  }
+  EXPECT_TRUE(half.empty());
+  EXPECT_EQ(snapshot.size(), 500);
+  EXPECT_EQ(set.size(), 1000);
+}
+
+TEST(persistentSet, EraseByIteratorMatchesStdSet) {
+  s21::persistent_set<int> set;
+  std::set<int> std_set;
+  for (int i = 0; i < 300; ++i) {
+    set.insert((i * 113) % 307);
+    std_set.insert((i * 113) % 307);
+  }
+  for (int i = 0; i < 307; i += 2) {
+    set.erase(set.find(i));
+    std_set.erase(i);
+  }
+  EXPECT_EQ(set.size(), std_set.size());
+  auto it = set.begin();
+  for (int key : std_set) EXPECT_EQ(*it++, key);
+}
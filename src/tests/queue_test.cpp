@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <memory>
+#include <string>
 
 #include "../lib/s21_queue.h"
 
@@ -155,4 +157,24 @@ TEST(Queue, Insert_Empty_front) {
   s21_queue.insert_many_back(0, 1);
   EXPECT_EQ(s21_queue.size(), 2);
   EXPECT_EQ(s21_queue.back(), 1);
-}
\ No newline at end of file
+}
+
+TEST(Queue, MoveOnlyAndEmplace) {
+  s21::queue<std::unique_ptr<std::string>> queue;
+  queue.push(std::make_unique<std::string>("a"));
+  queue.emplace(new std::string("b"));
+  queue.insert_many_back(std::make_unique<std::string>("c"),
+                         std::make_unique<std::string>("d"));
+  EXPECT_EQ(queue.size(), 4);
+  std::unique_ptr<std::string> first = std::move(queue.front());
+  queue.pop();
+  EXPECT_EQ(*first, "a");
+  EXPECT_EQ(*queue.front(), "b");
+  EXPECT_EQ(*queue.back(), "d");
+  // строка переезжает без копии
+  s21::queue<std::string> strings;
+  std::string text(100, 'x');
+  const char* buffer = text.data();
+  strings.push(std::move(text));
+  EXPECT_EQ(strings.front().data(), buffer);
+}
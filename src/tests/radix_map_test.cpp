@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+
+#include "../lib/s21_radix_map.h"
+
+template <typename Key, typename Value>
+static void expect_same(s21::radix_map<Key, Value>& map,
+                        const std::map<Key, Value>& expected) {
+  EXPECT_EQ(map.size(), expected.size());
+  auto it = map.begin();
+  for (const auto& item : expected) {
+    ASSERT_TRUE(it != map.end());
+    EXPECT_EQ(it->first, item.first);
+    EXPECT_EQ(it->second, item.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == map.end());
+}
+
+TEST(radixMap, DefaultConstructor) {
+  s21::radix_map<uint64_t, int> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.begin() == map.end());
+  EXPECT_FALSE(map.contains(0));
+  EXPECT_EQ(map.erase(0), 0);
+}
+
+TEST(radixMap, InsertFindAt) {
+  s21::radix_map<int, std::string> map = {{3, "three"}, {1, "one"}};
+  auto res = map.insert(2, "two");
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(res.first->second, "two");
+  res = map.insert(std::make_pair(2, "dos"));
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(map.at(2), "two");
+  map.insert_or_assign(2, "dos");
+  EXPECT_EQ(map[2], "dos");
+  EXPECT_EQ(map[4], "");
+  EXPECT_EQ(map.size(), 4);
+  EXPECT_THROW(map.at(5), std::out_of_range);
+  EXPECT_EQ(map.find(3)->second, "three");
+  EXPECT_TRUE(map.find(7) == map.end());
+}
+
+TEST(radixMap, SignedIntegerOrder) {
+  s21::radix_map<int64_t, int> map;
+  std::map<int64_t, int> expected;
+  for (int64_t key : {int64_t{-5}, int64_t{3}, int64_t{0},
+                      int64_t{-1000000000000}, INT64_MAX, INT64_MIN,
+                      int64_t{42}, int64_t{-1}}) {
+    map.insert(key, static_cast<int>(key % 1000));
+    expected[key] = static_cast<int>(key % 1000);
+  }
+  expect_same(map, expected);
+}
+
+TEST(radixMap, RandomIntegersMatchStdMap) {
+  // dense and sparse keys exercise every node size, growing and shrinking
+  for (uint64_t range : {300ULL, 1ULL << 40}) {
+    std::mt19937_64 rng(range);
+    s21::radix_map<uint64_t, uint64_t> map;
+    std::map<uint64_t, uint64_t> expected;
+    for (int i = 0; i < 5000; ++i) {
+      uint64_t key = rng() % range;
+      if (rng() % 3 == 0) {
+        EXPECT_EQ(map.erase(key), expected.erase(key));
+      } else {
+        map.insert_or_assign(key, i);
+        expected[key] = i;
+      }
+    }
+    expect_same(map, expected);
+    for (const auto& item : expected) EXPECT_EQ(map.at(item.first), item.second);
+    for (auto it = expected.begin(); it != expected.end();) {
+      EXPECT_EQ(map.erase(it->first), 1);
+      it = expected.erase(it);
+    }
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.begin() == map.end());
+  }
+}
+
+TEST(radixMap, StringKeysWithSharedPrefixes) {
+  s21::radix_map<std::string, int> map;
+  std::map<std::string, int> expected;
+  const char* keys[] = {"",
+                        "a",
+                        "ab",
+                        "abc",
+                        "http://example.com/",
+                        "http://example.com/index.html",
+                        "http://example.com/images/logo.png",
+                        "http://example.com/images/icon.png",
+                        "http://example.org/",
+                        "https://example.com/",
+                        "b"};
+  int value = 0;
+  for (const char* key : keys) {
+    map.insert(key, value);
+    expected[key] = value++;
+  }
+  expect_same(map, expected);
+  EXPECT_FALSE(map.contains("http://example.com/images"));
+  EXPECT_FALSE(map.contains("abcd"));
+
+  EXPECT_EQ(map.erase("http://example.com/images/icon.png"), 1);
+  expected.erase("http://example.com/images/icon.png");
+  EXPECT_EQ(map.erase("a"), 1);
+  expected.erase("a");
+  EXPECT_EQ(map.erase(""), 1);
+  expected.erase("");
+  expect_same(map, expected);
+
+  // a key splitting a long compressed path
+  map.insert("http://example.com/images/logo.jpg", 100);
+  expected["http://example.com/images/logo.jpg"] = 100;
+  map.insert("http://example.com/images/l", 101);
+  expected["http://example.com/images/l"] = 101;
+  expect_same(map, expected);
+}
+
+TEST(radixMap, RandomStringsMatchStdMap) {
+  std::mt19937 rng(11);
+  s21::radix_map<std::string, int> map;
+  std::map<std::string, int> expected;
+  for (int i = 0; i < 3000; ++i) {
+    std::string key = "/api/v1/";
+    int len = rng() % 12;
+    for (int j = 0; j < len; ++j) key += static_cast<char>('a' + rng() % 3);
+    if (rng() % 4 == 0) {
+      EXPECT_EQ(map.erase(key), expected.erase(key));
+    } else {
+      map.insert(key, i);
+      expected.insert({key, i});
+    }
+  }
+  expect_same(map, expected);
+}
+
+TEST(radixMap, FindIteratorContinuesInOrder) {
+  s21::radix_map<int, int> map;
+  for (int i = 0; i < 1000; i += 2) map.insert(i, i);
+  auto it = map.find(500);
+  for (int expected = 500; expected < 1000; expected += 2, ++it) {
+    EXPECT_EQ(it->first, expected);
+  }
+  EXPECT_TRUE(it == map.end());
+}
+
+TEST(radixMap, CopyMoveSwap) {
+  s21::radix_map<int, int> map = {{1, 1}, {2, 2}, {3, 3}};
+  s21::radix_map<int, int> copy(map);
+  copy.erase(2);
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(copy.size(), 2);
+  s21::radix_map<int, int> moved(std::move(map));
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(moved.size(), 3);
+  moved.swap(copy);
+  EXPECT_EQ(moved.size(), 2);
+  copy = std::move(moved);
+  EXPECT_EQ(copy.size(), 2);
+  copy.erase(copy.begin());
+  EXPECT_EQ(copy.begin()->first, 3);
+}
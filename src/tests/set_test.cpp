@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
 #include <iterator>
+#include <set>
 
 #include "../lib/s21_set.h"
 using namespace s21;
@@ -298,3 +301,216 @@ TEST(S21setTest, InsertManyFunction) {
 
   EXPECT_TRUE(set.contains(50));
 }
+
+TEST(S21setTest, BuildSorted) {
+  std::vector<int> items;
+  for (int i = 0; i < 1000; ++i) items.push_back(i * 2);
+  s21::set<int> s = {5, 7};
+  s.build_sorted(items.begin(), items.size());
+  EXPECT_EQ(s.size(), 1000);
+  EXPECT_FALSE(s.contains(5));
+  EXPECT_TRUE(s.contains(998));
+  int expected = 0;
+  for (auto it = s.begin(); it != s.end(); ++it, expected += 2) {
+    EXPECT_EQ(*it, expected);
+  }
+  s.insert(1);
+  s.erase(s.find(0));
+  EXPECT_EQ(*s.begin(), 1);
+}
+
+TEST(S21setTest, CompactLaysOutNodesInOrder) {
+  s21::set<int> s;
+  for (int i = 0; i < 500; ++i) s.insert((i * 7919) % 500);
+  for (int i = 0; i < 500; i += 5) s.erase(s.find(i));
+  s.compact();
+  EXPECT_EQ(s.size(), 400);
+  const int* previous = nullptr;
+  int expected = 0;
+  for (auto it = s.begin(); it != s.end(); ++it, ++expected) {
+    if (expected % 5 == 0) ++expected;
+    EXPECT_EQ(*it, expected);
+    // consecutive keys sit in consecutive nodes
+    if (previous != nullptr) {
+      EXPECT_EQ(reinterpret_cast<const char*>(&*it) -
+                    reinterpret_cast<const char*>(previous),
+                static_cast<long>(sizeof(s21::set<int>::Node)));
+    }
+    previous = &*it;
+  }
+  // a second compaction moves everything into a new block
+  s.insert(1000);
+  s.compact();
+  EXPECT_TRUE(s.contains(1000));
+  EXPECT_EQ(s.size(), 401);
+}
+
+TEST(S21setTest, CompactStepWithUpdatesInBetween) {
+  s21::set<int> s;
+  std::set<int> expected;
+  for (int i = 0; i < 300; ++i) {
+    s.insert((i * 31) % 300);
+    expected.insert((i * 31) % 300);
+  }
+  int round = 0;
+  while (!s.compact_step(10)) {
+    // erase right around the compaction cursor and elsewhere
+    for (int key : {round * 10, round * 10 + 3, 299 - round}) {
+      auto it = s.find(key);
+      if (it != s.end()) s.erase(it);
+      expected.erase(key);
+    }
+    s.insert(1000 + round);
+    expected.insert(1000 + round);
+    ++round;
+  }
+  EXPECT_EQ(s.size(), expected.size());
+  auto it = s.begin();
+  for (int key : expected) {
+    ASSERT_TRUE(it != s.end());
+    EXPECT_EQ(*it, key);
+    ++it;
+  }
+
+  s21::set<int> moved(std::move(s));
+  moved.compact();
+  EXPECT_EQ(moved.size(), expected.size());
+  EXPECT_EQ(*moved.begin(), *expected.begin());
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+}
+
+TEST(S21setTest, EraseAcrossManyCompactedBlocks) {
+  s21::set<int> s;
+  std::set<int> expected;
+  // every round leaves the previous block partly alive
+  for (int round = 0; round < 8; ++round) {
+    for (int i = 0; i < 50; ++i) {
+      s.insert(round * 100 + i);
+      expected.insert(round * 100 + i);
+    }
+    s.compact();
+    for (int i = 0; i < 50; i += 4) {
+      s.erase(s.find(round * 100 + i));
+      expected.erase(round * 100 + i);
+    }
+  }
+  EXPECT_EQ(s.size(), expected.size());
+  for (int key : expected) EXPECT_TRUE(s.contains(key));
+  for (int key = 0; key < 800; key += 3) {
+    auto it = s.find(key);
+    if (it != s.end()) s.erase(it);
+    expected.erase(key);
+  }
+  EXPECT_EQ(s.size(), expected.size());
+  auto it = s.begin();
+  for (int key : expected) {
+    ASSERT_TRUE(it != s.end());
+    EXPECT_EQ(*it, key);
+    ++it;
+  }
+  while (!s.empty()) s.erase(s.begin());
+  s.insert(1);
+  s.compact();
+  EXPECT_EQ(*s.begin(), 1);
+}
+
+TEST(S21setTest, ClearDuringCompaction) {
+  s21::set<int> s = {5, 3, 8, 1, 4, 7, 9};
+  EXPECT_FALSE(s.compact_step(2));
+  s.clear();
+  EXPECT_TRUE(s.empty());
+  EXPECT_TRUE(s.compact_step(1));
+  s.insert(2);
+  s.compact();
+  EXPECT_EQ(*s.begin(), 2);
+}
+
+TEST(S21setTest, SplayMovesAccessedKeyToRoot) {
+  s21::set<int> s(s21::set<int>::SPLAY);
+  std::set<int> expected;
+  for (int i = 0; i < 500; ++i) {
+    auto result = s.insert((i * 37) % 500);
+    EXPECT_EQ(result.first.getNode()->parent, nullptr);
+    expected.insert((i * 37) % 500);
+  }
+  EXPECT_EQ(s.find(123).getNode()->parent, nullptr);
+  EXPECT_EQ(s.find(7).getNode()->parent, nullptr);
+  EXPECT_TRUE(s.find(1000) == s.end());
+  for (int key = 0; key < 500; key += 3) {
+    s.erase(s.find(key));
+    expected.erase(key);
+  }
+  EXPECT_EQ(s.size(), expected.size());
+  auto it = s.begin();
+  for (int key : expected) {
+    ASSERT_TRUE(it != s.end());
+    EXPECT_EQ(*it, key);
+    ++it;
+  }
+  for (auto back = expected.rbegin(); back != expected.rend(); ++back) {
+    --it;
+    EXPECT_EQ(*it, *back);
+  }
+}
+
+TEST(S21setTest, SplayModeIsKeptByCopyAndSwap) {
+  s21::set<int> splayed(s21::set<int>::SPLAY);
+  splayed.insert(1);
+  s21::set<int> copy(splayed);
+  EXPECT_EQ(copy.balancing(), s21::set<int>::SPLAY);
+  s21::set<int> plain = {1, 2, 3};
+  plain.swap(copy);
+  EXPECT_EQ(plain.balancing(), s21::set<int>::SPLAY);
+  EXPECT_EQ(copy.balancing(), s21::set<int>::UNBALANCED);
+  plain.set_balancing(s21::set<int>::UNBALANCED);
+  EXPECT_TRUE(plain.contains(1));
+}
+
+static int TreeHeight(const s21::set<int>::Node* node) {
+  if (node == nullptr) return 0;
+  return 1 + std::max(TreeHeight(node->left), TreeHeight(node->right));
+}
+
+static int TreeHeight(s21::set<int>& s) {
+  const s21::set<int>::Node* root = s.begin().getNode();
+  while (root != nullptr && root->parent != nullptr) root = root->parent;
+  return TreeHeight(root);
+}
+
+TEST(S21setTest, ScapegoatKeepsSortedInsertsShallow) {
+  s21::set<int> s(s21::set<int>::SCAPEGOAT);
+  std::set<int> expected;
+  for (int key = 0; key < 5000; ++key) {
+    s.insert(key);
+    expected.insert(key);
+  }
+  EXPECT_LE(TreeHeight(s), std::log(5000.0) / std::log(1.5) + 1);
+  for (int key = 0; key < 5000; key += 4) {
+    s.erase(s.find(key));
+    expected.erase(key);
+  }
+  for (int key = 5000; key > -2000; key -= 7) {
+    s.insert(key);
+    expected.insert(key);
+  }
+  EXPECT_LE(TreeHeight(s), std::log(7000.0) / std::log(1.5) + 1);
+  EXPECT_EQ(s.size(), expected.size());
+  auto it = s.begin();
+  for (int key : expected) {
+    ASSERT_TRUE(it != s.end());
+    EXPECT_EQ(*it, key);
+    ++it;
+  }
+}
+
+TEST(S21setTest, SwitchingToScapegoatRebuilds) {
+  s21::set<int> s;
+  for (int key = 0; key < 1000; ++key) s.insert(key);
+  EXPECT_EQ(TreeHeight(s), 1000);
+  s.set_balancing(s21::set<int>::SCAPEGOAT);
+  EXPECT_EQ(TreeHeight(s), 10);
+  EXPECT_TRUE(s.contains(999));
+  s.clear();
+  EXPECT_TRUE(s.empty());
+}
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
 
 #include "../lib/s21_stack.h"
 
@@ -154,4 +157,19 @@ TEST(Stack, Insert_Empty_front) {
   s21_stack.insert_many_front(0, 10);
   EXPECT_EQ(s21_stack.size(), 2);
   EXPECT_EQ(s21_stack.top(), 10);
-}
\ No newline at end of file
+}
+
+TEST(Stack, MoveOnlyAndEmplace) {
+  s21::stack<std::unique_ptr<std::string>> stack;
+  stack.push(std::make_unique<std::string>("a"));
+  stack.emplace(new std::string("b"));
+  stack.insert_many_front(std::make_unique<std::string>("c"));
+  EXPECT_EQ(stack.size(), 3);
+  EXPECT_EQ(*stack.top(), "c");
+  std::unique_ptr<std::string> top = std::move(stack.top());
+  stack.pop();
+  EXPECT_EQ(*top, "c");
+  EXPECT_EQ(*stack.top(), "b");
+  s21::stack<std::pair<int, std::string>> pairs;
+  EXPECT_EQ(pairs.emplace(1, "x").second, "x");
+}
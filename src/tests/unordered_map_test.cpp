@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include "../lib/s21_unordered_map.h"
+
+TEST(unorderedMap, DefaultConstructor) {
+  s21::unordered_map<int, std::string> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.bucket_count(), 0);
+  EXPECT_TRUE(map.begin() == map.end());
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_EQ(map.erase(1), 0);
+}
+
+TEST(unorderedMap, InsertAccess) {
+  s21::unordered_map<int, std::string> map = {{1, "one"}, {2, "two"}};
+  EXPECT_EQ(map.size(), 2);
+  auto res = map.insert(3, "three");
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(res.first->second, "three");
+  res = map.insert(std::make_pair(3, "tres"));
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(map.at(3), "three");
+  map.insert_or_assign(3, "tres");
+  EXPECT_EQ(map.at(3), "tres");
+  EXPECT_EQ(map[4], "");
+  map[4] = "four";
+  EXPECT_EQ(map.at(4), "four");
+  EXPECT_THROW(map.at(5), std::out_of_range);
+  EXPECT_TRUE(map.find(5) == map.end());
+  EXPECT_EQ(map.size(), 4);
+}
+
+TEST(unorderedMap, InsertMany) {
+  s21::unordered_map<std::string, int> map;
+  auto results = map.insert_many(std::make_pair("a", 1), std::make_pair("b", 2),
+                                 std::make_pair("a", 3));
+  ASSERT_EQ(results.size(), 3);
+  EXPECT_TRUE(results[0].second);
+  EXPECT_TRUE(results[1].second);
+  EXPECT_FALSE(results[2].second);
+  EXPECT_EQ(map.at("a"), 1);
+}
+
+TEST(unorderedMap, RandomOperationsMatchStd) {
+  std::mt19937 rng(17);
+  s21::unordered_map<int, int> map;
+  std::unordered_map<int, int> expected;
+  for (int i = 0; i < 50000; ++i) {
+    int key = rng() % 4000;
+    switch (rng() % 3) {
+      case 0:
+        EXPECT_EQ(map.erase(key), expected.erase(key));
+        break;
+      case 1:
+        map.insert_or_assign(key, i);
+        expected[key] = i;
+        break;
+      default:
+        EXPECT_EQ(map.contains(key), expected.count(key) == 1);
+    }
+  }
+  EXPECT_EQ(map.size(), expected.size());
+  size_t visited = 0;
+  for (auto it = map.begin(); it != map.end(); ++it, ++visited) {
+    EXPECT_EQ(it->second, expected.at(it->first));
+  }
+  EXPECT_EQ(visited, expected.size());
+  EXPECT_LE(map.load_factor(), map.max_load_factor());
+}
+
+TEST(unorderedMap, ReserveAndRehash) {
+  s21::unordered_map<int, int> map;
+  map.reserve(1000);
+  size_t buckets = map.bucket_count();
+  EXPECT_GE(buckets * map.max_load_factor(), 1000);
+  for (int i = 0; i < 1000; ++i) map.insert(i, i);
+  EXPECT_EQ(map.bucket_count(), buckets);  // no growth after reserve
+
+  map.max_load_factor(0.5f);
+  map.rehash(0);
+  EXPECT_LE(map.load_factor(), 0.5f);
+  for (int i = 0; i < 1000; ++i) EXPECT_EQ(map.at(i), i);
+
+  for (int i = 0; i < 1000; ++i) map.erase(i);
+  map.rehash(0);
+  EXPECT_EQ(map.bucket_count(), 0);
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(unorderedMap, TombstonesDoNotGrowTable) {
+  s21::unordered_map<int, int> map;
+  map.reserve(100);
+  size_t buckets = map.bucket_count();
+  // a sliding window of keys keeps the size constant
+  for (int i = 0; i < 100000; ++i) {
+    map.insert(i, i);
+    if (i >= 50) {
+      EXPECT_EQ(map.erase(i - 50), 1);
+    }
+  }
+  EXPECT_EQ(map.size(), 50);
+  EXPECT_EQ(map.bucket_count(), buckets);
+  for (int i = 100000 - 50; i < 100000; ++i) EXPECT_TRUE(map.contains(i));
+}
+
+TEST(unorderedMap, EraseIteratorCopyMove) {
+  s21::unordered_map<int, std::string> map = {{1, "a"}, {2, "b"}, {3, "c"}};
+  map.erase(map.find(2));
+  EXPECT_FALSE(map.contains(2));
+  s21::unordered_map<int, std::string> copy(map);
+  copy[4] = "d";
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(copy.size(), 3);
+  s21::unordered_map<int, std::string> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.at(4), "d");
+  map = moved;
+  EXPECT_EQ(map.size(), 3);
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+  EXPECT_FALSE(moved.contains(1));
+  map.swap(moved);
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(moved.at(1), "a");
+}
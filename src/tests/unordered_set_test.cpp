@@ -0,0 +1,31 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../lib/s21_unordered_set.h"
+
+TEST(unorderedSet, InsertFindErase) {
+  s21::unordered_set<std::string> set = {"one", "two", "one"};
+  EXPECT_EQ(set.size(), 2);
+  EXPECT_TRUE(set.insert("three").second);
+  EXPECT_FALSE(set.insert("two").second);
+  EXPECT_EQ(*set.find("three"), "three");
+  EXPECT_TRUE(set.find("four") == set.end());
+  EXPECT_EQ(set.erase("one"), 1);
+  EXPECT_EQ(set.erase("one"), 0);
+  EXPECT_FALSE(set.contains("one"));
+  EXPECT_EQ(set.size(), 2);
+}
+
+TEST(unorderedSet, GrowthKeepsElements) {
+  s21::unordered_set<long> set;
+  for (long i = 0; i < 10000; ++i) set.insert(i * 1000003);
+  EXPECT_EQ(set.size(), 10000);
+  for (long i = 0; i < 10000; ++i) EXPECT_TRUE(set.contains(i * 1000003));
+  EXPECT_FALSE(set.contains(1));
+  size_t visited = 0;
+  for (auto it = set.begin(); it != set.end(); ++it) ++visited;
+  EXPECT_EQ(visited, 10000);
+  auto results = set.insert_many(1L, 2L, 1L);
+  EXPECT_FALSE(results[2].second);
+}
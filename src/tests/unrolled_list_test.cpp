@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../lib/s21_unrolled_list.h"
+
+// четыре элемента на блок, чтобы деление и слияние блоков шли часто
+using SmallList = s21::unrolled_list<std::string, 4 * sizeof(std::string)>;
+
+template <typename List>
+static std::vector<typename List::value_type> Forward(List& list) {
+  std::vector<typename List::value_type> result;
+  for (auto it = list.begin(); it != list.end(); ++it) result.push_back(*it);
+  return result;
+}
+
+template <typename List>
+static std::vector<typename List::value_type> Backward(List& list) {
+  std::vector<typename List::value_type> result;
+  for (auto it = list.end(); it != list.begin();) result.push_back(*--it);
+  return result;
+}
+
+TEST(UnrolledList, PushPopAndAccess) {
+  s21::unrolled_list<int> list = {2, 3};
+  EXPECT_EQ(s21::unrolled_list<int>::kCapacity, 64);
+  list.push_front(1);
+  list.push_back(4);
+  EXPECT_EQ(list.front(), 1);
+  EXPECT_EQ(list.back(), 4);
+  EXPECT_EQ(list.size(), 4);
+  list.pop_front();
+  list.pop_back();
+  EXPECT_EQ(Forward(list), (std::vector<int>{2, 3}));
+  list.pop_back();
+  list.pop_back();
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.chunk_count(), 0);
+  EXPECT_THROW(list.pop_front(), std::out_of_range);
+  EXPECT_THROW(list.pop_back(), std::out_of_range);
+}
+
+TEST(UnrolledList, RandomInsertEraseMatchesStdList) {
+  SmallList list;
+  std::list<std::string> expected;
+  std::mt19937 rng(46);
+  for (int step = 0; step < 3000; ++step) {
+    size_t at = expected.empty() ? 0 : rng() % (expected.size() + 1);
+    auto it = list.begin();
+    auto expected_it = expected.begin();
+    for (size_t i = 0; i < at; ++i, ++it, ++expected_it) {
+    }
+    if (rng() % 3 != 0 || expected.empty()) {
+      std::string value = std::to_string(step);
+      auto placed = list.insert(it, value);
+      EXPECT_EQ(*placed, value);
+      expected.insert(expected_it, value);
+    } else if (expected_it != expected.end()) {
+      auto next = list.erase(it);
+      auto expected_next = expected.erase(expected_it);
+      if (expected_next != expected.end()) {
+        EXPECT_EQ(*next, *expected_next);
+      } else {
+        EXPECT_TRUE(next == list.end());
+      }
+    }
+  }
+  ASSERT_EQ(list.size(), expected.size());
+  std::vector<std::string> forward(expected.begin(), expected.end());
+  EXPECT_EQ(Forward(list), forward);
+  std::vector<std::string> backward(expected.rbegin(), expected.rend());
+  EXPECT_EQ(Backward(list), backward);
+  // в среднем блоки заполнены хотя бы наполовину
+  EXPECT_LE(2 * list.chunk_count(), list.size());
+}
+
+TEST(UnrolledList, RangeEraseMergesChunks) {
+  SmallList list;
+  for (int i = 0; i < 40; ++i) list.push_back(std::to_string(i));
+  EXPECT_EQ(list.chunk_count(), 10);
+  auto first = list.begin();
+  for (int i = 0; i < 6; ++i) ++first;
+  auto last = first;
+  for (int i = 0; i < 30; ++i) ++last;
+  auto it = list.erase(first, last);
+  EXPECT_EQ(*it, "36");
+  EXPECT_EQ(list.size(), 10);
+  EXPECT_EQ(list.chunk_count(), 3);
+  EXPECT_EQ(Backward(list).front(), "39");
+  EXPECT_TRUE(list.erase(list.begin(), list.end()) == list.end());
+  EXPECT_TRUE(list.empty());
+  list.push_back("x");
+  EXPECT_EQ(list.front(), "x");
+}
+
+TEST(UnrolledList, SpliceIntoTheMiddleOfAChunk) {
+  SmallList list = {"a", "b", "c", "d"};
+  SmallList other = {"x", "y", "z"};
+  auto pos = list.begin();
+  ++pos;
+  ++pos;
+  list.splice(pos, other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(list.size(), 7);
+  EXPECT_EQ(Forward(list), (std::vector<std::string>{"a", "b", "x", "y", "z",
+                                                     "c", "d"}));
+  SmallList tail = {"e"};
+  list.splice(list.end(), tail);
+  SmallList head = {"0"};
+  list.splice(list.begin(), head);
+  EXPECT_EQ(list.front(), "0");
+  EXPECT_EQ(Backward(list).front(), "e");
+  EXPECT_EQ(list.size(), 9);
+}
+
+TEST(UnrolledList, SortAndMergeAreStable) {
+  using Item = std::pair<int, int>;
+  auto by_key = [](const Item& a, const Item& b) { return a.first < b.first; };
+  s21::unrolled_list<Item, 64> list, other;
+  std::list<Item> expected, expected_other;
+  for (int i = 0; i < 500; ++i) {
+    Item item = {(i * 37) % 11, i};
+    list.push_back(item);
+    expected.push_back(item);
+    Item more = {i % 7, -i};
+    other.push_back(more);
+    expected_other.push_back(more);
+  }
+  list.sort(by_key);
+  expected.sort(by_key);
+  other.sort(by_key);
+  expected_other.sort(by_key);
+  list.merge(other, by_key);
+  expected.merge(expected_other, by_key);
+  EXPECT_TRUE(other.empty());
+  std::vector<Item> forward(expected.begin(), expected.end());
+  EXPECT_EQ(Forward(list), forward);
+  s21::unrolled_list<int> numbers = {5, 3, 9, 1};
+  numbers.sort();
+  EXPECT_EQ(Forward(numbers), (std::vector<int>{1, 3, 5, 9}));
+}
+
+TEST(UnrolledList, UniqueRemoveReverse) {
+  SmallList list = {"a", "a", "b", "c", "c", "c", "a", "d", "d"};
+  EXPECT_EQ(list.unique(), 4);
+  EXPECT_EQ(Forward(list),
+            (std::vector<std::string>{"a", "b", "c", "a", "d"}));
+  // ссылка на элемент самого листа
+  EXPECT_EQ(list.remove(list.front()), 2);
+  EXPECT_EQ(list.remove_if([](const std::string& s) { return s == "d"; }),
+            1);
+  list.insert_many_back("e", "f");
+  list.insert_many_front("y", "z");
+  list.reverse();
+  EXPECT_EQ(Forward(list),
+            (std::vector<std::string>{"f", "e", "c", "b", "z", "y"}));
+  EXPECT_EQ(Backward(list).front(), "y");
+  auto it = list.insert_many(++list.begin(), "1", "2");
+  EXPECT_EQ(*it, "1");
+  EXPECT_EQ(list.size(), 8);
+  EXPECT_EQ(list.remove_if([](const std::string&) { return true; }), 8);
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.chunk_count(), 0);
+}
+
+TEST(UnrolledList, CopyMoveAndAssign) {
+  SmallList list;
+  for (int i = 0; i < 10; ++i) list.push_back(std::to_string(i));
+  SmallList copy(list);
+  SmallList moved(std::move(list));
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(Forward(copy), Forward(moved));
+  list = copy;
+  copy = std::move(moved);
+  EXPECT_EQ(list.size(), 10);
+  EXPECT_EQ(copy.back(), "9");
+  s21::unrolled_list<int> sized(100);
+  EXPECT_EQ(sized.size(), 100);
+  EXPECT_EQ(sized.back(), 0);
+}
+
+TEST(UnrolledList, MoveOnlyAndEmplace) {
+  s21::unrolled_list<std::unique_ptr<int>, 32> list;
+  for (int i = 0; i < 20; ++i) list.emplace_back(new int(i));
+  list.push_front(std::make_unique<int>(-1));
+  auto it = list.emplace(++list.begin(), new int(100));
+  EXPECT_EQ(**it, 100);
+  list.insert_many(list.end(), std::make_unique<int>(20),
+                   std::make_unique<int>(21));
+  EXPECT_EQ(list.size(), 24);
+  EXPECT_EQ(*list.back(), 21);
+  std::unique_ptr<int> first = std::move(list.front());
+  list.pop_front();
+  EXPECT_EQ(*first, -1);
+  EXPECT_EQ(*list.front(), 100);
+}